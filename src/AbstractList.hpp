@@ -26,17 +26,167 @@
 #ifndef LIST_ABSTRACT_LIST_HPP
 #define LIST_ABSTRACT_LIST_HPP
 
+#include <new>
 #include <stddef.h>
+#include <string.h>
+
+#if defined(__has_include)
+#if __has_include(<type_traits>)
+#include <type_traits>
+#define LIST_HAS_TYPE_TRAITS
+#endif
+#endif
+#if !defined(LIST_HAS_TYPE_TRAITS) && defined(__has_builtin)
+#if __has_builtin(__is_trivially_destructible)
+#define LIST_HAS_IS_TRIVIALLY_DESTRUCTIBLE
+#endif
+#endif
+
+/*!
+ * @brief   Policies defining, whether a list stores copies of the values
+ *          (immutable) or references to them (mutable).
+ */
+struct Storage {
+  /*!
+   * @brief The mutability is chosen at runtime by the constructor argument of
+   *        the list. This is the default and costs a flag per list and a branch
+   *        per access.
+   */
+  class Runtime {
+    bool mutableList = false;/// Is the list mutable or immutable.
+
+   public:
+    /*!
+     * @brief Constructor of a Runtime Object of an immutable list.
+     */
+    Runtime() {}
+
+    /*!
+     * @brief Constructor of a Runtime Object.
+     *
+     * @param mutableList true if the list should be mutable; false otherwise.
+     */
+    explicit Runtime(const bool mutableList) : mutableList(mutableList) {}
+
+    /*!
+     * @brief Check if the list is mutable.
+     *
+     * @return    true if the list is mutable; false otherwise.
+     */
+    bool isMutable() const { return mutableList; }
+
+    /*!
+     * @brief Memory for one entry of either layout, because the list may
+     *        create both.
+     *
+     * @tparam Immutable  Layout of an entry, that holds a copy of the value.
+     * @tparam Mutable    Layout of an entry, that holds a pointer to the value.
+     */
+    template<typename Immutable, typename Mutable>
+    union Entries {
+      Immutable immutableEntry;/// Size and alignment of immutable entries.
+      Mutable mutableEntry;/// Size and alignment of mutable entries.
+
+      Entries() {}
+      ~Entries() {}
+    };
+  };
+
+  /*!
+   * @brief The list is immutable at compile time: values are copied into the
+   *        list.
+   */
+  class ByValue {
+   public:
+    /*!
+     * @brief Constructor of a ByValue Object.
+     */
+    ByValue() {}
+
+    /*!
+     * @brief Reject a mutability argument at compile time, because the
+     *        mutability is fixed by the policy.
+     *
+     * @tparam B  Type of the argument.
+     */
+    template<typename B>
+    explicit ByValue(const B) {
+      static_assert(sizeof(B) == 0, "Lists with Storage::ByValue are always immutable; construct them without an argument");
+    }
+
+    /*!
+     * @copydoc Runtime::isMutable()
+     */
+    static bool isMutable() { return false; }
+
+    /*!
+     * @brief Memory for one entry, that holds a copy of the value.
+     *
+     * @copydetails Runtime::Entries
+     */
+    template<typename Immutable, typename Mutable>
+    union Entries {
+      Immutable immutableEntry;/// Size and alignment of immutable entries.
+
+      Entries() {}
+      ~Entries() {}
+    };
+  };
+
+  /*!
+   * @brief The list is mutable at compile time: only references to the values
+   *        are stored.
+   */
+  class ByReference {
+   public:
+    /*!
+     * @brief Constructor of a ByReference Object.
+     */
+    ByReference() {}
+
+    /*!
+     * @copydoc ByValue::ByValue(const B)
+     */
+    template<typename B>
+    explicit ByReference(const B) {
+      static_assert(sizeof(B) == 0, "Lists with Storage::ByReference are always mutable; construct them without an argument");
+    }
+
+    /*!
+     * @copydoc Runtime::isMutable()
+     */
+    static bool isMutable() { return true; }
+
+    /*!
+     * @brief Memory for one entry, that holds a pointer to the value.
+     *
+     * @copydetails Runtime::Entries
+     */
+    template<typename Immutable, typename Mutable>
+    union Entries {
+      Mutable mutableEntry;/// Size and alignment of mutable entries.
+
+      Entries() {}
+      ~Entries() {}
+    };
+  };
+};
 
 /*!
  * @brief   Abstract class from which all lists can be derived.
  *
  * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam S    Storage policy (see Storage). Storage::ByValue and
+ *              Storage::ByReference fix the mutability at compile time, which
+ *              removes the mutability flag and its branches.
+ * @tparam I    Type of the size and of the indices (default int). A smaller
+ *              type, like uint8_t for lists with less than 256 entries,
+ *              shrinks the list and speeds up index arithmetic on 8-bit
+ *              targets.
  */
-template<typename T>
-class AbstractList {
-  size_t size = 0;         /// Size of the list.
-  bool mutableList = false;/// Is the list mutable or immutable.
+template<typename T, typename S = Storage::Runtime, typename I = int>
+class AbstractList : private S {
+  I size = 0;/// Size of the list.
 
  protected:
   /// Sometimes it is allowed, that index == this->getSize() to insert it behind
@@ -44,49 +194,305 @@ class AbstractList {
 #define extendedIsIndexOutOfBounds(index) \
   ((index) != this->getSize() && this->isIndexOutOfBounds(index))
 
-  /**
-   * Class representing an abstract entry in the list.
+  /*!
+   * @brief Entry layout of immutable lists. It extends the entry of the
+   *        concrete list, which holds the links, by a copy of the value.
+   *
+   * @tparam Links  Entry type of the concrete list.
    */
-  class AbstractEntry {
-    T immutableValue;         /// The raw value, assigned for immutable lists.
-    T *mutableValue = nullptr;/// A pointer to the raw value, assigned for mutable lists.
+  template<typename Links>
+  class ImmutableEntry : public Links {
+    T value;/// The raw value.
 
    public:
     /*!
-     * @brief   Get a pointer to the value (mutable or immutable).
+     * @brief Constructor of an ImmutableEntry Object.
      *
-     * @param m   Indicates, if the list is mutable or immutable.
+     * @param val   Value to copy into the entry.
+     */
+    explicit ImmutableEntry(T &val) : value(val) {}
+
+    /*!
+     * @brief   Get a pointer to the value.
      *
      * @return  Pointer to the value of the entry.
      */
-    T *getValue(const bool m) {
-      if (m) {
-        return mutableValue;
-      }
-      return &immutableValue;
-    }
+    T *getValue() { return &value; }
+  };
+
+  /*!
+   * @brief Entry layout of mutable lists. It extends the entry of the
+   *        concrete list, which holds the links, by a pointer to the value.
+   *
+   * @tparam Links  Entry type of the concrete list.
+   */
+  template<typename Links>
+  class MutableEntry : public Links {
+    T *value;/// A pointer to the raw value.
 
+   public:
     /*!
-     * @brief   Set the value.
+     * @brief Constructor of a MutableEntry Object.
      *
      * @param val   Reference to the value.
-     * @param m   Indicates, if the list is mutable or immutable.
      */
-    void setValue(T &val, const bool m) {
-      if (m) {
-        mutableValue = &val;
-      } else {
-        immutableValue = val;
-      }
+    explicit MutableEntry(T &val) : value(&val) {}
+
+    /*!
+     * @brief   Get a pointer to the value.
+     *
+     * @return  Pointer to the value of the entry.
+     */
+    T *getValue() { return value; }
+  };
+
+  /*!
+   * @brief   Get a pointer to the value of an entry, created by createEntry().
+   *
+   * @tparam Links  Entry type of the concrete list.
+   * @param entry   The entry.
+   * @param m   Indicates, if the list is mutable or immutable.
+   * @return  Pointer to the value of the entry.
+   */
+  template<typename Links>
+  static T *getEntryValue(Links *entry, const bool m) {
+    if (m) {
+      return static_cast<MutableEntry<Links> *>(entry)->getValue();
     }
+    return static_cast<ImmutableEntry<Links> *>(entry)->getValue();
+  }
+
+  /*!
+   * @brief   Create a new entry, that only stores what the mutability of the
+   *          list requires: a copy of the value or a pointer to it.
+   *
+   * @tparam Links  Entry type of the concrete list.
+   * @param value   Value of the new entry.
+   * @return  The new entry, or nullptr if the allocation failed.
+   */
+  template<typename Links>
+  Links *createEntry(T &value) {
+    if (isMutable()) {
+      return new (std::nothrow) MutableEntry<Links>(value);
+    }
+    return new (std::nothrow) ImmutableEntry<Links>(value);
+  }
+
+  /*!
+   * @brief   Delete an entry, created by createEntry().
+   *
+   * @tparam Links  Entry type of the concrete list.
+   * @param entry   The entry to delete.
+   */
+  template<typename Links>
+  void deleteEntry(Links *entry) {
+    if (isMutable()) {
+      delete static_cast<MutableEntry<Links> *>(entry);
+    } else {
+      delete static_cast<ImmutableEntry<Links> *>(entry);
+    }
+  }
+
+  /*!
+   * @brief   Get the size of an entry, created by constructEntry().
+   *
+   * @tparam Links  Entry type of the concrete list.
+   * @return  Size of the entry in bytes.
+   */
+  template<typename Links>
+  size_t getEntrySize() const {
+    if (isMutable()) {
+      return sizeof(MutableEntry<Links>);
+    }
+    return sizeof(ImmutableEntry<Links>);
+  }
+
+  /*!
+   * @brief   Construct an entry in the given memory, like createEntry().
+   *
+   * @tparam Links  Entry type of the concrete list.
+   * @param memory  Memory, that is large enough and suitably aligned for the
+   *                entry.
+   * @param value   Value of the new entry.
+   * @return  The new entry.
+   */
+  template<typename Links>
+  Links *constructEntry(void *memory, T &value) {
+    if (isMutable()) {
+      return new (memory) MutableEntry<Links>(value);
+    }
+    return new (memory) ImmutableEntry<Links>(value);
+  }
+
+  /*!
+   * @brief   Destroy an entry, created by constructEntry(), without freeing its
+   *          memory.
+   *
+   * @tparam Links  Entry type of the concrete list.
+   * @param entry   The entry to destroy.
+   * @return  The memory of the entry.
+   */
+  template<typename Links>
+  void *destroyEntry(Links *entry) {
+    if (isMutable()) {
+      MutableEntry<Links> *mutableEntry = static_cast<MutableEntry<Links> *>(entry);
+      mutableEntry->~MutableEntry<Links>();
+      return mutableEntry;
+    }
+    ImmutableEntry<Links> *immutableEntry = static_cast<ImmutableEntry<Links> *>(entry);
+    immutableEntry->~ImmutableEntry<Links>();
+    return immutableEntry;
+  }
+
+  /*!
+   * @brief Slot of array based lists, that holds a copy of the value
+   *        (immutable lists). The value is constructed and destroyed
+   *        explicitly, so unused slots do not require a default constructor.
+   */
+  union ValueSlot {
+    T value;/// The raw value, only valid if the slot is in use.
+
+    /*!
+     * @brief Constructor of an unused ValueSlot Object.
+     */
+    ValueSlot() {}
+
+    /*!
+     * @brief Destructor of a ValueSlot Object. The value must be destroyed
+     *        by destroySlot() before.
+     */
+    ~ValueSlot() {}
   };
 
+  /// Slot of array based lists, that holds a pointer to the value (mutable
+  /// lists).
+  typedef T *ReferenceSlot;
+
+  /*!
+   * @brief Store a copy of the value in an unused slot.
+   *
+   * @param slot    The unused slot.
+   * @param value   Value to store.
+   */
+  static void constructSlot(ValueSlot &slot, T &value) { new (&slot.value) T(value); }
+
+  /*!
+   * @brief Store a pointer to the value in an unused slot.
+   *
+   * @param slot    The unused slot.
+   * @param value   Value to reference.
+   */
+  static void constructSlot(ReferenceSlot &slot, T &value) { slot = &value; }
+
+  /*!
+   * @brief Destroy the value of a slot, which becomes unused afterwards.
+   *
+   * @param slot    The slot to destroy.
+   */
+  static void destroySlot(ValueSlot &slot) { slot.value.~T(); }
+
+  /*!
+   * @copydoc AbstractList::destroySlot(ValueSlot&)
+   */
+  static void destroySlot(ReferenceSlot &) {}
+
+  /*!
+   * @brief Move the value of a slot into an unused slot. The source slot is
+   *        unused afterwards.
+   *
+   * @param to      The unused target slot.
+   * @param from    The source slot.
+   */
+  static void moveSlot(ValueSlot &to, ValueSlot &from) {
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+    new (&to.value) T(static_cast<T &&>(from.value));
+#else
+    new (&to.value) T(from.value);
+#endif
+    from.value.~T();
+  }
+
+  /*!
+   * @copydoc AbstractList::moveSlot(ValueSlot&, ValueSlot&)
+   */
+  static void moveSlot(ReferenceSlot &to, ReferenceSlot &from) { to = from; }
+
+  /*!
+   * @brief Check if values of type T need no destructor call.
+   *
+   * @return    true if the destructor of T is trivial; false otherwise.
+   */
+  static bool isTriviallyDestructible() {
+#if defined(LIST_HAS_TYPE_TRAITS)
+    return std::is_trivially_destructible<T>::value;
+#elif defined(LIST_HAS_IS_TRIVIALLY_DESTRUCTIBLE)
+    return __is_trivially_destructible(T);
+#else
+    return __has_trivial_destructor(T);
+#endif
+  }
+
+  /*!
+   * @brief Move a range of used slots to another, possibly overlapping,
+   *        position. Trivially copyable values are moved with memmove(),
+   *        others one by one.
+   *
+   * @param to      First slot of the target range.
+   * @param from    First slot of the source range.
+   * @param count   Number of slots to move.
+   */
+  static void moveSlots(ValueSlot *to, ValueSlot *from, const int count) {
+    if (count <= 0 || to == from) {
+      return;
+    }
+    if (__is_trivially_copyable(T)) {
+      memmove(static_cast<void *>(to), static_cast<void *>(from), count * sizeof(ValueSlot));
+    } else if (to < from) {
+      for (int i = 0; i < count; ++i) {
+        moveSlot(to[i], from[i]);
+      }
+    } else {
+      for (int i = count - 1; i >= 0; --i) {
+        moveSlot(to[i], from[i]);
+      }
+    }
+  }
+
+  /*!
+   * @copydoc AbstractList::moveSlots(ValueSlot*, ValueSlot*, int)
+   */
+  static void moveSlots(ReferenceSlot *to, ReferenceSlot *from, const int count) {
+    if (count > 0) {
+      memmove(to, from, count * sizeof(ReferenceSlot));
+    }
+  }
+
+  /*!
+   * @brief Get a pointer to the value of a used slot.
+   *
+   * @param slot    The slot.
+   * @return    Pointer to the value.
+   */
+  static T *getSlotValue(ValueSlot &slot) { return &slot.value; }
+
+  /*!
+   * @copydoc AbstractList::getSlotValue(ValueSlot&)
+   */
+  static T *getSlotValue(ReferenceSlot &slot) { return slot; }
+
+  /*!
+   * @brief Constructor of an AbstractList Object, with the mutability of the
+   *        storage policy (immutable for Storage::Runtime).
+   */
+  AbstractList() {}
+
   /*!
    * @brief Constructor of an AbstractList Object.
    *
    * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only Storage::Runtime takes this argument.
    */
-  explicit AbstractList<T>(const bool mutableList) : mutableList(mutableList) {}
+  explicit AbstractList(const bool mutableList) : S(mutableList) {}
 
   /*!
    * @brief Get a pointer to the element, stored at specific index.
@@ -100,7 +506,7 @@ class AbstractList {
    * @note Allowed indices are 0 to getSize() -1. If the index is out of bounds,
    * a nullptr will be returned.
    */
-  virtual T *getPointer(int index) = 0;
+  virtual T *getPointer(I index) = 0;
 
   /*!
    * @brief Increase the size of the list by one. Should only be called after an
@@ -127,7 +533,29 @@ class AbstractList {
    * @return    true if the given index is in the range of the list; false
    *            otherwise
    */
-  bool isIndexOutOfBounds(const int index) const { return index < 0 || index >= getSize(); }
+  bool isIndexOutOfBounds(const I index) const { return index < 0 || index >= getSize(); }
+
+  /*!
+   * @brief Check if the size of the list reached the maximum of the index
+   *        type, so no further entry can be added.
+   *
+   * @return    true if no entry can be added; false otherwise.
+   */
+  bool isSizeLimitReached() const { return static_cast<I>(size + 1) <= size; }
+
+  /*!
+   * @brief Get the largest value of the index type, which is the largest size
+   *        of the list.
+   *
+   * @return    The largest value of the index type.
+   */
+  static I getSizeLimit() {
+    I limit = 1;
+    while (static_cast<I>(2UL * limit + 1) > limit) {
+      limit = static_cast<I>(2UL * limit + 1);
+    }
+    return limit;
+  }
 
  public:
   /*!
@@ -152,19 +580,23 @@ class AbstractList {
    *        entry.
    * @note  Allowed indices are 0 to getSize(). If the index is out of bounds,
    * nothing will happen.
+   * @note  If the size reached the maximum of the index type, nothing will
+   * happen.
+   * @note  If the memory for the new value cannot be allocated, nothing will
+   * happen. Use tryAddAtIndex() to detect this.
    * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
    *
    * @param index   Index of the entry, where the value should be added.
    * @param value   Value of the new entry.
    */
-  virtual void addAtIndex(int index, T &value) = 0;
+  virtual void addAtIndex(I index, T &value) = 0;
 
 #if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
   /*!
    * @copydoc AbstractList::addAtIndex()
    * @note If the list is mutable nothing happen.
    */
-  virtual void addAtIndex(const int index, T &&value) {
+  virtual void addAtIndex(const I index, T &&value) {
     if (this->isMutable()) {
       return;// Mutable lists cannot save rvalues!
     }
@@ -172,6 +604,61 @@ class AbstractList {
   }
 #endif
 
+  /*!
+   * @brief Add the value to the list at the given index, like addAtIndex(),
+   *        and report, if it was added.
+   * @note  The value is not added, if the index is out of bounds, the size
+   *        reached the maximum of the index type or the memory for the new
+   *        value cannot be allocated. The list is unchanged then.
+   * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
+   *
+   * @param index   Index of the entry, where the value should be added.
+   * @param value   Value of the new entry.
+   * @return    true if the value was added; false otherwise.
+   */
+  bool tryAddAtIndex(const I index, T &value) {
+    I oldSize = getSize();
+    addAtIndex(index, value);
+    return getSize() != oldSize;
+  }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @copydoc AbstractList::tryAddAtIndex()
+   * @note If the list is mutable, nothing happen and false is returned.
+   */
+  bool tryAddAtIndex(const I index, T &&value) {
+    if (this->isMutable()) {
+      return false;// Mutable lists cannot save rvalues!
+    }
+    return tryAddAtIndex(index, value);
+  }
+#endif
+
+  /*!
+   * @brief Add the value at the end of the list, like add(), and report, if
+   *        it was added.
+   * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
+   * @see tryAddAtIndex()
+   *
+   * @param value   Value to add.
+   * @return    true if the value was added; false otherwise.
+   */
+  bool tryAdd(T &value) { return tryAddAtIndex(getSize(), value); }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @copydoc AbstractList::tryAdd()
+   * @note If the list is mutable, nothing happen and false is returned.
+   */
+  bool tryAdd(T &&value) {
+    if (this->isMutable()) {
+      return false;// Mutable lists cannot save rvalues!
+    }
+    return tryAdd(value);
+  }
+#endif
+
   /*!
    * @brief Add all entries from the given list to this list at a specified
    * index. The original entry at this index, and followings, will be placed
@@ -179,11 +666,14 @@ class AbstractList {
    * @note The elements from the other list, remain untouched.
    * @note  If the other list is mutable and the values saved in the lists are primitives, nothing happens.
    *
+   * @tparam S2    Storage policy of the other list.
+   * @tparam I2    Index type of the other list.
    * @param index   Index of this list, at which all entries should be added.
    * @param list    Other list from where to copy the entries.
    */
-  void addAll(int index, AbstractList<T> &list) {
-    for (int i = 0; i < list.getSize(); i++) {
+  template<typename S2, typename I2>
+  void addAll(I index, AbstractList<T, S2, I2> &list) {
+    for (I2 i = 0; i < list.getSize(); i++) {
       addAtIndex(index++, list.get(i));
     }
   }
@@ -193,9 +683,12 @@ class AbstractList {
    * @note The elements from the other list, remain untouched.
    * @note  If the other list is mutable and the values saved in the lists are primitives, nothing happens.
    *
+   * @tparam S2    Storage policy of the other list.
+   * @tparam I2    Index type of the other list.
    * @param list    Other list to copy from.
    */
-  void addAll(AbstractList<T> &list) { addAll(getSize(), list); }
+  template<typename S2, typename I2>
+  void addAll(AbstractList<T, S2, I2> &list) { addAll(getSize(), list); }
 
   /*!
    * @brief Add all entries from an array to this list at a specified index.
@@ -208,7 +701,7 @@ class AbstractList {
    * @param arr Array.
    * @param arrSize Size of the array.
    */
-  void addAll(int index, T *arr, const size_t arrSize) {
+  void addAll(I index, T *arr, const size_t arrSize) {
     for (size_t i = 0; i < arrSize; ++i) {
       addAtIndex(index++, arr[i]);
     }
@@ -272,7 +765,107 @@ class AbstractList {
    * @param index   Index of the element to get.
    * @return    Immutable object.
    */
-  T get(const int index) { return *this->getPointer(index); }
+  T get(const I index) { return *this->getPointer(index); }
+
+  /*!
+   * @brief Get the values at several indices at once.
+   *
+   * @note If the indices are sorted ascending, all values are collected in a
+   * single traversal of the list, because every lookup continues from the
+   * previous one.
+   * @note Indices, that are out of bounds, are skipped and the corresponding
+   * element of the output array stays untouched.
+   *
+   * @param indices Array of indices of the elements to get.
+   * @param n   Number of indices.
+   * @param out Array with at least n elements, to which the values are copied.
+   * @return    Number of indices, that were in bounds.
+   */
+  size_t getMany(const I *indices, const size_t n, T *out) {
+    size_t found = 0;
+    for (size_t i = 0; i < n; ++i) {
+      T *pointer = this->getPointer(indices[i]);
+      if (pointer != nullptr) {
+        out[i] = *pointer;
+        found++;
+      }
+    }
+    return found;
+  }
+
+  /*!
+   * @brief Get pointers to the values at several indices at once.
+   *
+   * @note If the indices are sorted ascending, all values are collected in a
+   * single traversal of the list, because every lookup continues from the
+   * previous one.
+   * @note For indices, that are out of bounds, the nullptr is stored.
+   *
+   * @param indices Array of indices of the elements to get.
+   * @param n   Number of indices.
+   * @param out Array with at least n elements, to which the pointers are
+   * written.
+   * @return    Number of indices, that were in bounds.
+   */
+  size_t getMany(const I *indices, const size_t n, T **out) {
+    size_t found = 0;
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = this->getPointer(indices[i]);
+      if (out[i] != nullptr) {
+        found++;
+      }
+    }
+    return found;
+  }
+
+  /*!
+   * @brief Get a reference to the value at a specified index.
+   *
+   * @note Allowed indices are 0 to getSize() - 1. If the index is out of
+   * bounds, undefined behaviour will happen. Please be sure, that the index is
+   * valid!
+   * @note In contrast to get(), the value is not copied. For mutable lists,
+   * the reference points to the original variable.
+   *
+   * @param index   Index of the element to get.
+   * @return    Reference to the value.
+   */
+  T &at(const I index) { return *this->getPointer(index); }
+
+  /*!
+   * @copydoc AbstractList::at()
+   */
+  const T &at(const I index) const { return *const_cast<AbstractList *>(this)->getPointer(index); }
+
+  /*!
+   * @brief Get a reference to the first value of the list.
+   *
+   * @note The list must not be empty, otherwise undefined behaviour will
+   * happen.
+   *
+   * @return    Reference to the first value.
+   */
+  T &front() { return at(0); }
+
+  /*!
+   * @copydoc AbstractList::front()
+   */
+  const T &front() const { return at(0); }
+
+  /*!
+   * @brief Get a reference to the last value of the list.
+   *
+   * @note The list must not be empty, otherwise undefined behaviour will
+   * happen.
+   *
+   * @return    Reference to the last value.
+   */
+  T &back() { return at(getSize() - 1); }
+
+  /*!
+   * @copydoc AbstractList::back()
+   */
+  const T &back() const { return at(getSize() - 1); }
 
   /*!
    * @brief Get the pointer to the mutable object at a specified index.
@@ -286,7 +879,7 @@ class AbstractList {
    * @return Mutable object, or nullptr if the index is out of bounds or the
    * list is immutable.
    */
-  T *getMutableValue(const int index) {
+  T *getMutableValue(const I index) {
     if (!this->isMutable()) {
       return nullptr;
     }
@@ -307,7 +900,7 @@ class AbstractList {
    *
    * @param index   Index of element to remove.
    */
-  virtual void remove(int index) = 0;
+  virtual void remove(I index) = 0;
 
   /*!
    * @brief Remove the first entry from the list.
@@ -331,14 +924,14 @@ class AbstractList {
    *
    * @return    Size of the list.
    */
-  int getSize() const { return size; }
+  I getSize() const { return size; }
 
   /*!
    * @brief Check if the list is mutable.
    *
    * @return    true if the list is mutable; false otherwise.
    */
-  bool isMutable() const { return mutableList; }
+  bool isMutable() const { return S::isMutable(); }
 
   /*!
    * @brief Check if the list is empty.
@@ -352,10 +945,13 @@ class AbstractList {
    * @note  If you use this list for non-primitive data types, check if the
    *        data type implements the != operator!
    *
+   * @tparam S2    Storage policy of the other list.
+   * @tparam I2    Index type of the other list.
    * @param other    Second list to compare.
    * @return    true if the lists are equal; false otherwise.
    */
-  bool equals(AbstractList<T> &other) {
+  template<typename S2, typename I2>
+  bool equals(AbstractList<T, S2, I2> &other) {
     if (other.isMutable() != this->isMutable()) {
       return false;
     }
@@ -364,13 +960,13 @@ class AbstractList {
       return false;
     }
 
-    for (int i = 0; i < getSize(); i++) {
+    for (I i = 0; i < getSize(); i++) {
       if (this->isMutable()) {
         if (other.getMutableValue(i) != this->getMutableValue(i)) {
           return false;
         }
       } else {
-        if (other.get(i) != this->get(i)) {
+        if (other.at(i) != this->at(i)) {
           return false;
         }
       }
@@ -382,13 +978,14 @@ class AbstractList {
    * @copydoc AbstractList::get()
    * @see   get()
    */
-  T operator[](const int index) { return get(index); }
+  T operator[](const I index) { return get(index); }
 
   /*!
    * @copydoc AbstractList::equals()
    * @see   equals()
    */
-  bool operator==(AbstractList<T> &other) { return equals(other); }
+  template<typename S2, typename I2>
+  bool operator==(AbstractList<T, S2, I2> &other) { return equals(other); }
 
   /*!
    * @brief Opposite of '=='
@@ -397,7 +994,8 @@ class AbstractList {
    * @param other Other list to compare
    * @return    true if the lists are not equal; false otherwise.
    */
-  bool operator!=(AbstractList<T> &other) { return !this->equals(other); }
+  template<typename S2, typename I2>
+  bool operator!=(AbstractList<T, S2, I2> &other) { return !this->equals(other); }
 
   /*!
    * @copydoc AbstractList::add()
@@ -416,11 +1014,12 @@ class AbstractList {
 #endif
 
   /*!
-   * @copydoc AbstractList::addAll(AbstractList<T>&)
+   * @copydoc AbstractList::addAll(AbstractList<T, S2, I2>&)
    * @note  If the other list is mutable and the values saved in the lists are primitives, nothing happens.
-   * @see addAll(AbstractList<T>&)
+   * @see addAll(AbstractList<T, S2, I2>&)
    */
-  void operator+(AbstractList<T> &list) { this->addAll(list); }
+  template<typename S2, typename I2>
+  void operator+(AbstractList<T, S2, I2> &list) { this->addAll(list); }
 };
 
 #endif// LIST_ABSTRACT_LIST_HPP
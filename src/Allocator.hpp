@@ -0,0 +1,493 @@
+/*!
+ * @file Allocator.hpp
+ *
+ * This file is part of the List library. It extends the arduino ecosystem with
+ * easy-to-use list implementations. They are specially designed and optimized
+ * for different purposes.
+ *
+ * Copyright (C) 2024  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef LIST_ALLOCATOR_HPP
+#define LIST_ALLOCATOR_HPP
+
+#include <new>
+#include <stddef.h>
+
+/*!
+ * @brief   Policies defining, where the linked lists get the memory of their
+ *          entries from.
+ *
+ * @note    An allocator is a class with a default constructor and the methods
+ *          void *allocate(size_t size) and void deallocate(void *memory,
+ *          size_t size). Every list owns its own allocator object, so an allocator can keep
+ *          state, like a static region of memory. The size passed to
+ *          deallocate() is the one, the memory was allocated with. allocate()
+ *          returns nullptr, if no memory is left; the lists then do not add
+ *          the value.
+ * @note    An allocator, that can free all of its memory at once, may
+ *          additionally declare static const bool resettable = true and the
+ *          method void reset(). The lists then clear themselves by calling
+ *          reset() instead of deallocating every entry. Allocators without
+ *          these members are not resettable (see Traits).
+ * @note    An allocator, that can preallocate entries, may additionally
+ *          declare the method bool reserve(size_t count, size_t size), which
+ *          returns true if the next count allocations need no further work.
+ *          Of the built-in allocators, Pool and Arena honor reserve(); Heap
+ *          and allocators without this method cannot reserve.
+ */
+struct Allocator {
+ private:
+  /*!
+   * @brief Get the resettable constant of an allocator, that declares it.
+   *
+   * @tparam A  The allocator.
+   * @tparam R  The resettable constant of the allocator.
+   * @return    The constant.
+   */
+  template<typename A, bool R = A::resettable>
+  static constexpr bool isResettable(int) {
+    return R;
+  }
+
+  /*!
+   * @brief Fallback for allocators, that do not declare the resettable
+   *        constant.
+   *
+   * @tparam A  The allocator.
+   * @return    false.
+   */
+  template<typename A>
+  static constexpr bool isResettable(...) {
+    return false;
+  }
+
+  /*!
+   * @brief Reserve entries with an allocator, that declares reserve().
+   *
+   * @tparam A  The allocator.
+   * @param allocator   The allocator.
+   * @param count   Number of entries.
+   * @param size    Size of an entry in bytes.
+   * @return    The result of reserve() of the allocator.
+   */
+  template<typename A>
+  static auto reserveEntries(A &allocator, const size_t count, const size_t size, int)
+      -> decltype(static_cast<bool>(allocator.reserve(count, size))) {
+    return allocator.reserve(count, size);
+  }
+
+  /*!
+   * @brief Fallback for allocators, that do not declare reserve().
+   *
+   * @tparam A  The allocator.
+   * @return    false, because nothing can be reserved.
+   */
+  template<typename A>
+  static bool reserveEntries(A &, const size_t, const size_t, ...) {
+    return false;
+  }
+
+ public:
+  /*!
+   * @brief Type with the strictest alignment of the basic types.
+   */
+  union Align {
+    void *pointer;/// Alignment of pointers.
+    long long integer;/// Alignment of integers.
+    long double floating;/// Alignment of floating point numbers.
+  };
+
+  /*!
+   * @brief Header of a block of memory for many entries, followed by its
+   *        memory.
+   */
+  struct Block {
+    Block *next;/// The next block.
+    size_t capacity;/// Number of bytes of the block.
+    Align memory[1];/// Begin of the memory of the block.
+
+    /*!
+     * @brief Allocate a new block.
+     *
+     * @param capacity    Number of bytes of the block.
+     * @param next        The next block.
+     * @return    The new block, or nullptr if the allocation failed.
+     */
+    static Block *create(const size_t capacity, Block *next) {
+      Block *block = static_cast<Block *>(::operator new(sizeof(Block) - sizeof(Align) + capacity, std::nothrow));
+      if (block == nullptr) {
+        return nullptr;
+      }
+      block->next = next;
+      block->capacity = capacity;
+      return block;
+    }
+
+    /*!
+     * @brief Check if the given memory lies inside this block.
+     *
+     * @param address Memory to check.
+     * @return    true if the memory belongs to this block; false otherwise.
+     */
+    bool contains(const void *address) const {
+      const char *begin = reinterpret_cast<const char *>(memory);
+      return address >= begin && address < begin + capacity;
+    }
+  };
+
+  /*!
+   * @brief The optional members of an allocator, with defaults for allocators,
+   *        that do not declare them.
+   *
+   * @tparam A  The allocator.
+   */
+  template<typename A>
+  class Traits {
+    /*!
+     * @brief Tag selecting an overload by a constant.
+     */
+    template<bool Value>
+    struct Flag {};
+
+    static void reset(A &allocator, Flag<true>) { allocator.reset(); }
+    static void reset(A &, Flag<false>) {}
+
+   public:
+    static const bool resettable = Allocator::isResettable<A>(0);/// Can the allocator free all memory at once.
+
+    /*!
+     * @brief Free all memory of the allocator at once, if it is resettable;
+     *        otherwise nothing happens.
+     *
+     * @param allocator   The allocator.
+     */
+    static void reset(A &allocator) { reset(allocator, Flag<resettable>()); }
+
+    /*!
+     * @brief Preallocate entries, if the allocator can reserve them.
+     *
+     * @param allocator   The allocator.
+     * @param count   Number of entries.
+     * @param size    Size of an entry in bytes.
+     * @return    true if the entries are reserved; false if the allocator
+     *            cannot reserve entries or the allocation failed.
+     */
+    static bool reserve(A &allocator, const size_t count, const size_t size) {
+      return Allocator::reserveEntries(allocator, count, size, 0);
+    }
+  };
+
+  /*!
+   * @brief Every entry is allocated with new and freed with delete. This is the
+   *        default.
+   */
+  class Heap {
+   public:
+    /*!
+     * @brief Allocate memory for one entry.
+     *
+     * @param size    Size of the entry in bytes.
+     * @return    Memory, that is suitably aligned for the entry, or nullptr if
+     *            the allocation failed.
+     */
+    void *allocate(const size_t size) { return ::operator new(size, std::nothrow); }
+
+    /*!
+     * @brief Free the memory of one entry.
+     *
+     * @param memory  Memory returned by allocate().
+     */
+    void deallocate(void *memory, const size_t) { ::operator delete(memory); }
+
+    /*!
+     * @brief Preallocate memory for the given number of entries, so that the
+     *        next allocations need no further allocator work. Nothing can be
+     *        reserved, because every entry is allocated on its own; use Pool
+     *        or Arena for lists, that have to reserve entries.
+     *
+     * @param count   Number of entries.
+     * @param size    Size of an entry in bytes.
+     * @return    true if nothing had to be reserved (count is 0); false
+     *            otherwise.
+     */
+    bool reserve(const size_t count, const size_t size) {
+      (void) size;
+      return count == 0;
+    }
+  };
+
+  /*!
+   * @brief Freed entries are kept on a free list and reused by the next
+   *        allocations, so a list, whose size stays about the same while
+   *        values are added and removed, does not call new and delete anymore
+   *        and does not fragment the heap. The kept entries are freed, when
+   *        the list is destroyed or release() is called. Reserved entries are
+   *        allocated together in one block, which is freed with the list.
+   *
+   * @note  All entries of a list have the same size, so every kept entry fits
+   *        every allocation.
+   */
+  class Pool {
+    /*!
+     * @brief A kept entry, which links to the next kept entry.
+     */
+    struct Free {
+      Free *next;/// The next kept entry.
+    };
+
+    Free *freeList = nullptr;/// The first kept entry.
+    size_t kept = 0;/// Number of kept entries.
+    Block *blocks = nullptr;/// The blocks of the reserved entries.
+
+    /*!
+     * @brief Check if the given entry was reserved.
+     *
+     * @param entry   The entry.
+     * @return    true if the entry lies in a block; false otherwise.
+     */
+    bool isReserved(const void *entry) const {
+      for (Block *block = blocks; block != nullptr; block = block->next) {
+        if (block->contains(entry)) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+   public:
+    /*!
+     * @brief Destructor of a Pool Object. Frees the kept entries and the
+     *        blocks.
+     */
+    ~Pool() {
+      release();
+      while (blocks != nullptr) {
+        Block *next = blocks->next;
+        ::operator delete(blocks);
+        blocks = next;
+      }
+    }
+
+    /*!
+     * @copydoc Heap::allocate()
+     * @note  A kept entry is reused, if there is one.
+     */
+    void *allocate(const size_t size) {
+      if (freeList == nullptr) {
+        return ::operator new(size < sizeof(Free) ? sizeof(Free) : size, std::nothrow);
+      }
+      Free *memory = freeList;
+      freeList = memory->next;
+      kept--;
+      return memory;
+    }
+
+    /*!
+     * @copydoc Heap::deallocate()
+     * @note  The memory is kept for the next allocation.
+     */
+    void deallocate(void *memory, const size_t) {
+      Free *free = static_cast<Free *>(memory);
+      free->next = freeList;
+      freeList = free;
+      kept++;
+    }
+
+    /*!
+     * @brief Preallocate memory for the given number of entries, so that the
+     *        next allocations need no further allocator work.
+     * @note  The kept entries count as reserved; only the missing entries are
+     *        allocated in one block.
+     *
+     * @param count   Number of entries.
+     * @param size    Size of an entry in bytes.
+     * @return    true if the entries are reserved; false if the allocation
+     *            failed.
+     */
+    bool reserve(size_t count, size_t size) {
+      if (count <= kept) {
+        return true;
+      }
+      count -= kept;
+
+      size = size < sizeof(Free) ? sizeof(Free) : size;
+      Block *block = Block::create(count * size, blocks);
+      if (block == nullptr) {
+        return false;// the allocation failed, so nothing is reserved
+      }
+      blocks = block;
+      char *memory = reinterpret_cast<char *>(blocks->memory);
+      for (size_t i = count; i > 0; --i) {
+        deallocate(memory + (i - 1) * size, size);
+      }
+      return true;
+    }
+
+    /*!
+     * @brief Free all kept entries, except the reserved ones.
+     */
+    void release() {
+      Free *reserved = nullptr;
+      while (freeList != nullptr) {
+        Free *next = freeList->next;
+        if (isReserved(freeList)) {
+          freeList->next = reserved;
+          reserved = freeList;
+        } else {
+          ::operator delete(freeList);
+          kept--;
+        }
+        freeList = next;
+      }
+      freeList = reserved;
+    }
+  };
+
+  /*!
+   * @brief Entries are carved one after another from large blocks. Removing an
+   *        entry does not give its memory back; instead clear() resets the
+   *        whole arena at once, which only has to destroy the values if their
+   *        type has a destructor. The blocks are kept for refilling the list
+   *        and are freed, when the list is destroyed or release() is called.
+   *
+   * @note  Suited for scratch lists, that are filled and cleared again and
+   *        again, like once per frame. Lists, from which single values are
+   *        removed often, should use Pool instead.
+   *
+   * @tparam BlockSize  Number of bytes of a block (default 256). Entries larger
+   *                    than a block get a block of their own size.
+   */
+  template<size_t BlockSize = 256>
+  class Arena {
+    Block *first = nullptr;/// The first block.
+    Block *current = nullptr;/// The block, entries are carved from.
+    size_t used = 0;/// Number of used bytes of the current block.
+
+    /*!
+     * @brief Round the given size up to the alignment of all entries.
+     *
+     * @note  The alignment may be smaller than the size of Align (e.g. 1 byte
+     *        on AVR), so rounding to the size would waste memory.
+     *
+     * @param size    Size in bytes.
+     * @return    The aligned size.
+     */
+    static size_t align(const size_t size) { return (size + alignof(Align) - 1) & ~(alignof(Align) - 1); }
+
+   public:
+    /*!
+     * @brief Destructor of an Arena Object. Frees all blocks.
+     */
+    ~Arena() { release(); }
+
+    /*!
+     * @copydoc Heap::allocate()
+     * @note  A new block is only allocated, if no kept block is left.
+     */
+    void *allocate(size_t size) {
+      size = align(size);
+      if (current == nullptr || used + size > current->capacity) {
+        Block *next = current == nullptr ? first : current->next;
+        if (next == nullptr || next->capacity < size) {
+          Block *block = Block::create(size > BlockSize ? size : BlockSize, next);
+          if (block == nullptr) {
+            return nullptr;
+          }
+          if (current == nullptr) {
+            first = block;
+          } else {
+            current->next = block;
+          }
+          next = block;
+        }
+        current = next;
+        used = 0;
+      }
+
+      void *memory = reinterpret_cast<char *>(current->memory) + used;
+      used += size;
+      return memory;
+    }
+
+    /*!
+     * @copydoc Heap::deallocate()
+     * @note  The memory is not given back until reset() is called.
+     */
+    void deallocate(void *, const size_t) {}
+
+    /*!
+     * @copydoc Pool::reserve()
+     * @note  If the kept blocks are too small, one block for the missing
+     *        entries is appended.
+     */
+    bool reserve(size_t count, size_t size) {
+      size = align(size);
+      Block *last = nullptr;
+      Block *block = current == nullptr ? first : current;
+      size_t free = current == nullptr ? 0 : current->capacity - used;
+      while (block != nullptr) {
+        if (block != current) {
+          free = block->capacity;
+        }
+        size_t fitting = free / size;
+        if (fitting >= count) {
+          return true;
+        }
+        count -= fitting;
+        last = block;
+        block = block->next;
+      }
+
+      Block *reserved = Block::create(count * size > BlockSize ? count * size : BlockSize, nullptr);
+      if (reserved == nullptr) {
+        return false;// the allocation failed, so nothing is reserved
+      }
+      if (last == nullptr) {
+        first = reserved;
+      } else {
+        last->next = reserved;
+      }
+      return true;
+    }
+
+    static const bool resettable = true;/// All entries are freed at once.
+
+    /*!
+     * @brief Free all entries at once. The blocks are kept.
+     */
+    void reset() {
+      current = nullptr;
+      used = 0;
+    }
+
+    /*!
+     * @brief Free all blocks. Must only be called, while the list is empty.
+     */
+    void release() {
+      while (first != nullptr) {
+        Block *next = first->next;
+        ::operator delete(first);
+        first = next;
+      }
+      reset();
+    }
+  };
+};
+
+#endif// LIST_ALLOCATOR_HPP
@@ -0,0 +1,272 @@
+/*!
+ * @file ArrayList.hpp
+ *
+ * This file is part of the List library. It extends the arduino ecosystem with
+ * easy-to-use list implementations. They are specially designed and optimized
+ * for different purposes.
+ *
+ * Copyright (C) 2024  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef LIST_ARRAY_LIST_HPP
+#define LIST_ARRAY_LIST_HPP
+
+#include "AbstractList.hpp"
+
+/*!
+ * @brief   Implementation of a list, that stores its values in one contiguous
+ *          array. Accessing an index is O(1), adding and removing shifts the
+ *          values behind the index. The array doubles its capacity, whenever it
+ *          is full.
+ *
+ * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam S    Storage policy (see Storage).
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ */
+template<typename T, typename S = Storage::Runtime, typename I = int>
+class ArrayList : public AbstractList<T, S, I> {
+  typedef typename AbstractList<T, S, I>::ValueSlot ValueSlot;
+  typedef typename AbstractList<T, S, I>::ReferenceSlot ReferenceSlot;
+
+  void *slots = nullptr;/// The array of slots, of which the first getSize() are used.
+  I capacity = 0;/// Number of slots of the array.
+
+  /*!
+   * @brief Get the array of slots.
+   *
+   * @tparam Slot   ValueSlot for immutable lists; ReferenceSlot for mutable
+   *                lists.
+   * @return    The array of slots.
+   */
+  template<typename Slot>
+  Slot *getSlots() {
+    return static_cast<Slot *>(slots);
+  }
+
+  /*!
+   * @brief Replace the array of slots by a new one with the given capacity and
+   *        move all values into it.
+   *
+   * @tparam Slot   Slot type of the array.
+   * @param newCapacity New number of slots, at least getSize().
+   * @return    true if the array was replaced; false if the allocation failed,
+   *            leaving the array unchanged.
+   */
+  template<typename Slot>
+  bool reallocate(const I newCapacity) {
+    Slot *newSlots = new (std::nothrow) Slot[newCapacity];
+    if (newSlots == nullptr) {
+      return false;
+    }
+    AbstractList<T, S, I>::moveSlots(newSlots, getSlots<Slot>(), this->getSize());
+    delete[] getSlots<Slot>();
+    slots = newSlots;
+    capacity = newCapacity;
+    return true;
+  }
+
+  /*!
+   * @brief Get the capacity of the array after growing: twice the capacity,
+   *        but at most the largest value of the index type.
+   *
+   * @return    The new capacity.
+   */
+  I getGrownCapacity() const {
+    if (capacity == 0) {
+      return 4;
+    }
+    unsigned long limit = AbstractList<T, S, I>::getSizeLimit();
+    return static_cast<I>(2UL * capacity > limit ? limit : 2UL * capacity);
+  }
+
+  /*!
+   * @brief Add a value at the given index.
+   *
+   * @tparam Slot   Slot type of the array.
+   * @param index   Index in the range 0 to getSize().
+   * @param value   Value to add.
+   */
+  template<typename Slot>
+  void addAtIndexWithSlots(const I index, T &value) {
+    if (this->getSize() == capacity && !reallocate<Slot>(getGrownCapacity())) {
+      return;// the allocation failed
+    }
+
+    Slot *array = getSlots<Slot>();
+    AbstractList<T, S, I>::moveSlots(array + index + 1, array + index, this->getSize() - index);
+    AbstractList<T, S, I>::constructSlot(array[index], value);
+    this->increaseSize();
+  }
+
+  /*!
+   * @brief Remove the value at the given index.
+   *
+   * @tparam Slot   Slot type of the array.
+   * @param index   Index in the range 0 to getSize() - 1.
+   */
+  template<typename Slot>
+  void removeWithSlots(const I index) {
+    Slot *array = getSlots<Slot>();
+    AbstractList<T, S, I>::destroySlot(array[index]);
+    AbstractList<T, S, I>::moveSlots(array + index, array + index + 1, this->getSize() - index - 1);
+    this->decreaseSize();
+  }
+
+  /*!
+   * @brief Destroy all values. The array is kept.
+   *
+   * @tparam Slot   Slot type of the array.
+   */
+  template<typename Slot>
+  void clearWithSlots() {
+    Slot *array = getSlots<Slot>();
+    for (I i = 0; i < this->getSize(); ++i) {
+      AbstractList<T, S, I>::destroySlot(array[i]);
+    }
+  }
+
+ protected:
+  /*!
+   * @copydoc AbstractList::getPointer()
+   */
+  T *getPointer(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return nullptr;
+    }
+
+    if (this->isMutable()) {
+      return AbstractList<T, S, I>::getSlotValue(getSlots<ReferenceSlot>()[index]);
+    }
+    return AbstractList<T, S, I>::getSlotValue(getSlots<ValueSlot>()[index]);
+  }
+
+ public:
+  /*!
+   * @brief Constructor of an ArrayList Object. It is immutable, unless the
+   *        storage policy fixes it to be mutable.
+   */
+  ArrayList() {}
+
+  /*!
+   * @brief Constructor of an ArrayList Object.
+   *
+   * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only lists with the storage policy Storage::Runtime take this
+   *        argument; with Storage::ByValue and Storage::ByReference, it does
+   *        not compile.
+   */
+  explicit ArrayList(bool mutableList)
+      : AbstractList<T, S, I>(mutableList) {}
+
+  /*!
+   * @brief Destructor of an ArrayList Object.
+   */
+  ~ArrayList() {
+    this->clear();
+    if (this->isMutable()) {
+      delete[] getSlots<ReferenceSlot>();
+    } else {
+      delete[] getSlots<ValueSlot>();
+    }
+  }
+
+  /*!
+   * @brief Get the number of values, the list can hold without growing its
+   *        array.
+   *
+   * @return    The capacity of the array.
+   */
+  I getCapacity() const { return capacity; }
+
+  /*!
+   * @brief Grow the array to hold at least the given number of values, so
+   *        that adding values up to this size does not reallocate.
+   *
+   * @note  If the allocation fails, the capacity is unchanged.
+   *
+   * @param count   Number of values, the list should hold without growing.
+   * @return    true if the array can hold this number of values; false if the
+   *            allocation failed.
+   */
+  bool reserve(const I count) {
+    if (count <= capacity) {
+      return true;
+    }
+
+    if (this->isMutable()) {
+      return reallocate<ReferenceSlot>(count);
+    }
+    return reallocate<ValueSlot>(count);
+  }
+
+  using AbstractList<T, S, I>::addAtIndex;///'Using' the addAtIndex method, to
+                                          /// prevent name hiding of the
+                                          /// addAtIndex method from AbstractList
+
+  /*!
+   * @copydoc AbstractList::addAtIndex()
+   */
+  void addAtIndex(I index, T &value) override {
+    // it is allowed, that index == this->getSize() to insert it behind the last
+    // entry
+    if (extendedIsIndexOutOfBounds(index) || this->isSizeLimitReached()) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      addAtIndexWithSlots<ReferenceSlot>(index, value);
+    } else {
+      addAtIndexWithSlots<ValueSlot>(index, value);
+    }
+  }
+
+  /*!
+   * @copydoc AbstractList::clear()
+   * @note  The array is kept, so the list can be refilled without allocating.
+   */
+  void clear() override {
+    if (this->getSize() == 0) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      clearWithSlots<ReferenceSlot>();
+    } else {
+      clearWithSlots<ValueSlot>();
+    }
+
+    this->resetSize();
+  }
+
+  /*!
+   * @copydoc AbstractList::remove()
+   */
+  void remove(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      removeWithSlots<ReferenceSlot>(index);
+    } else {
+      removeWithSlots<ValueSlot>(index);
+    }
+  }
+};
+
+#endif// LIST_ARRAY_LIST_HPP
@@ -0,0 +1,425 @@
+/*!
+ * @file CompactLinkedList.hpp
+ *
+ * This file is part of the List library. It extends the arduino ecosystem with
+ * easy-to-use list implementations. They are specially designed and optimized
+ * for different purposes.
+ *
+ * Copyright (C) 2024  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef LIST_COMPACT_LINKED_LIST_HPP
+#define LIST_COMPACT_LINKED_LIST_HPP
+
+#include <stdint.h>
+
+#include "AbstractList.hpp"
+
+/*!
+ * @brief   Implementation of a double-linked list, whose nodes live in a
+ *          private pool. Nodes are linked by their position in the pool
+ *          instead of by pointers, so a link costs only sizeof(L) bytes and
+ *          the nodes stay dense in memory. The pool doubles its capacity,
+ *          whenever it is full; removed nodes are reused by later insertions.
+ *
+ * @note    The pool holds at most 2^(8 * sizeof(L)) - 1 nodes. Adding to a list,
+ *          whose pool cannot grow any further, is ignored.
+ *
+ * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam L    Unsigned type of the links (default uint16_t). uint8_t limits
+ *              the list to 255 entries.
+ * @tparam S    Storage policy (see Storage).
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ */
+template<typename T, typename L = uint16_t, typename S = Storage::Runtime, typename I = int>
+class CompactLinkedList : public AbstractList<T, S, I> {
+  static_assert(static_cast<L>(-1) > 0, "CompactLinkedList needs an unsigned link type");
+
+  typedef typename AbstractList<T, S, I>::ValueSlot ValueSlot;
+  typedef typename AbstractList<T, S, I>::ReferenceSlot ReferenceSlot;
+
+  static const L none = static_cast<L>(-1);/// Link value, that refers to no node.
+
+  /*!
+   * @brief Class representing one node of the pool.
+   *
+   * @tparam Slot   ValueSlot for immutable lists; ReferenceSlot for mutable
+   *                lists.
+   */
+  template<typename Slot>
+  class Node {
+   public:
+    L prev;/// Position of the previous node of the list.
+    L next;/// Position of the next node of the list, or of the next free node.
+    Slot slot;/// The value of the node; unused if the node is free.
+  };
+
+  void *nodes = nullptr;/// The pool of nodes.
+  I cursorIndex = 0;/// The index of the last visited node.
+  L capacity = 0;/// Number of nodes of the pool.
+  L head = none;/// Position of the first node of the list.
+  L tail = none;/// Position of the last node of the list.
+  L cursor = none;/// Position of the last visited node.
+  L freeList = none;/// Position of the first unused node of the pool.
+
+  /*!
+   * @brief Get the pool of nodes.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   * @return    The array of nodes.
+   */
+  template<typename Slot>
+  Node<Slot> *getNodes() {
+    return static_cast<Node<Slot> *>(nodes);
+  }
+
+  /*!
+   * @brief Replace the pool by one with the given capacity. The positions of
+   *        all nodes are kept, so the links stay valid. The new nodes are put
+   *        on the free list.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   * @param newCapacity New number of nodes, greater than the capacity and at
+   *                    most none.
+   * @return    true if the pool was replaced; false if the allocation failed,
+   *            leaving the pool unchanged.
+   */
+  template<typename Slot>
+  bool reallocate(const unsigned long newCapacity) {
+    Node<Slot> *old = getNodes<Slot>();
+    Node<Slot> *grown = new (std::nothrow) Node<Slot>[newCapacity];
+    if (grown == nullptr) {
+      return false;
+    }
+    for (L i = 0; i < capacity; ++i) {
+      grown[i].prev = old[i].prev;
+      grown[i].next = old[i].next;
+    }
+    for (L i = head; i != none; i = old[i].next) {
+      AbstractList<T, S, I>::moveSlot(grown[i].slot, old[i].slot);
+    }
+
+    for (unsigned long i = capacity; i < newCapacity; ++i) {
+      grown[i].next = i + 1 < newCapacity ? static_cast<L>(i + 1) : freeList;
+    }
+    freeList = capacity;
+
+    delete[] old;
+    nodes = grown;
+    capacity = newCapacity;
+    return true;
+  }
+
+  /*!
+   * @brief Replace the pool by one with twice the capacity.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   * @return    true if the pool has grown; false if it has reached the maximal
+   *            capacity of the link type or of the index type, or the
+   *            allocation failed.
+   */
+  template<typename Slot>
+  bool grow() {
+    unsigned long limit = AbstractList<T, S, I>::getSizeLimit();
+    if (limit > none) {
+      limit = none;
+    }
+    if (capacity >= limit) {
+      return false;
+    }
+
+    unsigned long newCapacity = capacity == 0 ? 4 : 2UL * capacity;
+    return reallocate<Slot>(newCapacity > limit ? limit : newCapacity);
+  }
+
+  /*!
+   * @brief Find the node at the given index. The search starts at the nearest
+   *        finger, which is either the head, the tail or the last visited
+   *        node. Afterwards, the found node is the new last visited node.
+   *
+   * @note  The index must be in the range 0 to getSize() - 1.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   * @param index   Index of the node to find.
+   * @return    Position of the node at the given index.
+   */
+  template<typename Slot>
+  L findNode(I index) {
+    Node<Slot> *array = getNodes<Slot>();
+    L current = head;
+    I i = 0;
+    I distance = index;
+    if (this->getSize() - 1 - index < distance) {
+      current = tail;
+      i = this->getSize() - 1;
+      distance = i - index;
+    }
+    if (cursor != none) {
+      I cursorDistance = index > cursorIndex ? index - cursorIndex : cursorIndex - index;
+      if (cursorDistance < distance) {
+        current = cursor;
+        i = cursorIndex;
+      }
+    }
+
+    while (i < index) {
+      current = array[current].next;
+      i++;
+    }
+    while (i > index) {
+      current = array[current].prev;
+      i--;
+    }
+
+    cursor = current;
+    cursorIndex = index;
+    return current;
+  }
+
+  /*!
+   * @brief Add a value at the given index.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   * @param index   Index in the range 0 to getSize().
+   * @param value   Value to add.
+   */
+  template<typename Slot>
+  void addAtIndexWithSlots(const I index, T &value) {
+    if (freeList == none && !grow<Slot>()) {
+      return;
+    }
+
+    Node<Slot> *array = getNodes<Slot>();
+    L node = freeList;
+    freeList = array[node].next;
+    AbstractList<T, S, I>::constructSlot(array[node].slot, value);
+
+    L next = index == this->getSize() ? none : findNode<Slot>(index);
+    L prev = next == none ? tail : array[next].prev;
+    array[node].prev = prev;
+    array[node].next = next;
+    if (prev == none) {
+      head = node;
+    } else {
+      array[prev].next = node;
+    }
+    if (next == none) {
+      tail = node;
+    } else {
+      array[next].prev = node;
+    }
+
+    cursor = node;
+    cursorIndex = index;
+    this->increaseSize();
+  }
+
+  /*!
+   * @brief Remove the value at the given index and put its node on the free
+   *        list.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   * @param index   Index in the range 0 to getSize() - 1.
+   */
+  template<typename Slot>
+  void removeWithSlots(const I index) {
+    Node<Slot> *array = getNodes<Slot>();
+    L node = findNode<Slot>(index);
+    L prev = array[node].prev;
+    L next = array[node].next;
+
+    if (prev == none) {
+      head = next;
+    } else {
+      array[prev].next = next;
+    }
+    if (next == none) {
+      tail = prev;
+    } else {
+      array[next].prev = prev;
+    }
+
+    AbstractList<T, S, I>::destroySlot(array[node].slot);
+    array[node].next = freeList;
+    freeList = node;
+
+    // the next node moves to the index of the removed one
+    cursor = next;
+    cursorIndex = next == none ? 0 : index;
+    this->decreaseSize();
+  }
+
+  /*!
+   * @brief Destroy all values and put all nodes on the free list. The pool is
+   *        kept.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   */
+  template<typename Slot>
+  void clearWithSlots() {
+    Node<Slot> *array = getNodes<Slot>();
+    L current = head;
+    while (current != none) {
+      L next = array[current].next;
+      AbstractList<T, S, I>::destroySlot(array[current].slot);
+      array[current].next = freeList;
+      freeList = current;
+      current = next;
+    }
+  }
+
+ protected:
+  /*!
+   * @copydoc AbstractList::getPointer()
+   */
+  T *getPointer(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return nullptr;
+    }
+
+    if (this->isMutable()) {
+      return AbstractList<T, S, I>::getSlotValue(getNodes<ReferenceSlot>()[findNode<ReferenceSlot>(index)].slot);
+    }
+    return AbstractList<T, S, I>::getSlotValue(getNodes<ValueSlot>()[findNode<ValueSlot>(index)].slot);
+  }
+
+ public:
+  /*!
+   * @brief Constructor of a CompactLinkedList Object. It is immutable, unless the
+   *        storage policy fixes it to be mutable.
+   */
+  CompactLinkedList() {}
+
+  /*!
+   * @brief Constructor of a CompactLinkedList Object.
+   *
+   * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only lists with the storage policy Storage::Runtime take this
+   *        argument; with Storage::ByValue and Storage::ByReference, it does
+   *        not compile.
+   */
+  explicit CompactLinkedList(bool mutableList)
+      : AbstractList<T, S, I>(mutableList) {}
+
+  /*!
+   * @brief Destructor of a CompactLinkedList Object.
+   */
+  ~CompactLinkedList() {
+    this->clear();
+    if (this->isMutable()) {
+      delete[] getNodes<ReferenceSlot>();
+    } else {
+      delete[] getNodes<ValueSlot>();
+    }
+  }
+
+  /*!
+   * @brief Get the number of values, the list can hold without growing its
+   *        pool.
+   *
+   * @return    The capacity of the pool.
+   */
+  I getCapacity() const { return capacity; }
+
+  /*!
+   * @brief Grow the pool to hold at least the given number of values, so
+   *        that adding values up to this size does not reallocate.
+   *
+   * @note  The capacity is limited by the link type. If the allocation fails,
+   *        the capacity is unchanged.
+   *
+   * @param count   Number of values, the list should hold without growing.
+   * @return    true if the pool can hold this number of values; false if the
+   *            link type limits the capacity or the allocation failed.
+   */
+  bool reserve(const I count) {
+    long newCapacity = static_cast<long>(count) > none ? none : static_cast<long>(count);
+    if (newCapacity > capacity) {
+      bool grown;
+      if (this->isMutable()) {
+        grown = reallocate<ReferenceSlot>(newCapacity);
+      } else {
+        grown = reallocate<ValueSlot>(newCapacity);
+      }
+      if (!grown) {
+        return false;
+      }
+    }
+    return static_cast<long>(count) <= none;
+  }
+
+  using AbstractList<T, S, I>::addAtIndex;///'Using' the addAtIndex method, to
+                                          /// prevent name hiding of the
+                                          /// addAtIndex method from AbstractList
+
+  /*!
+   * @copydoc AbstractList::addAtIndex()
+   */
+  void addAtIndex(I index, T &value) override {
+    // it is allowed, that index == this->getSize() to insert it behind the last
+    // entry
+    if (extendedIsIndexOutOfBounds(index) || this->isSizeLimitReached()) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      addAtIndexWithSlots<ReferenceSlot>(index, value);
+    } else {
+      addAtIndexWithSlots<ValueSlot>(index, value);
+    }
+  }
+
+  /*!
+   * @copydoc AbstractList::clear()
+   * @note  The pool is kept, so the list can be refilled without allocating.
+   */
+  void clear() override {
+    if (this->getSize() == 0) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      clearWithSlots<ReferenceSlot>();
+    } else {
+      clearWithSlots<ValueSlot>();
+    }
+
+    this->resetSize();
+    head = none;
+    tail = none;
+    cursor = none;
+    cursorIndex = 0;
+  }
+
+  /*!
+   * @copydoc AbstractList::remove()
+   */
+  void remove(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      removeWithSlots<ReferenceSlot>(index);
+    } else {
+      removeWithSlots<ValueSlot>(index);
+    }
+  }
+};
+
+#endif// LIST_COMPACT_LINKED_LIST_HPP
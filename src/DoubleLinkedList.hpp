@@ -27,22 +27,40 @@
 #define LIST_DOUBLE_LINKED_LIST_HPP
 
 #include "AbstractList.hpp"
+#include "Allocator.hpp"
+#include "InlineEntries.hpp"
 
 /*!
  * @brief   Implementation of a double-linked list.
  *
  * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam S    Storage policy (see Storage).
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ * @tparam K    Number of entries, that are stored inside the list object
+ *              before entries are allocated (default 0).
+ * @tparam A    Allocator of the entries (see Allocator).
  */
-template<typename T>
-class DoubleLinkedList : public AbstractList<T> {
+template<typename T, typename S = Storage::Runtime, typename I = int, int K = 0, typename A = Allocator::Heap>
+class DoubleLinkedList : public AbstractList<T, S, I>, private InlineEntries<T, 2, K, S>, private A {
   /*!
    * @brief   Class representing one entry of the list.
    */
-  class Entry : public AbstractList<T>::AbstractEntry {
+  class Entry {
     Entry *prev = nullptr;/// Pointer to the previous element of the list.
     Entry *next = nullptr;/// Pointer to the next element of the list.
 
    public:
+    /*!
+     * @brief   Get a pointer to the value (mutable or immutable).
+     *
+     * @note    The entry must be created by AbstractList::createEntry().
+     *
+     * @param m   Indicates, if the list is mutable or immutable.
+     *
+     * @return  Pointer to the value of the entry.
+     */
+    T *getValue(const bool m) { return AbstractList<T, S, I>::getEntryValue(this, m); }
+
     /*!
      * @brief   Destructor of an Entry Object.
      */
@@ -80,190 +98,801 @@ class DoubleLinkedList : public AbstractList<T> {
     void setPrev(Entry *prevEntry) { prev = prevEntry; }
   };
 
+  I cursorIndex = 0;/// The index of the last visited entry.
   Entry *head = nullptr;/// The first entry of the list.
   Entry *tail = nullptr;/// The last entry of the list.
+  Entry *cursor = nullptr;/// The last entry visited by getPointer().
 
- protected:
   /*!
-   * @copydoc AbstractList::getPointer()
+   * @brief Forget the last visited entry. Must be called after every
+   *        structural change, that could move or delete the cursor entry.
    */
-  T *getPointer(int index) override {
-    if (this->isIndexOutOfBounds(index)) {
-      return nullptr;
-    }
+  void resetCursor() {
+    cursor = nullptr;
+    cursorIndex = 0;
+  }
 
-    Entry *current;
-    // optimize searching in large lists
-    if (index > abs(this->getSize() / 2)) {
-      current = tail;
-      for (int i = this->getSize(); i > index + 1; --i) {
-        current = current->getPrev();
+  /*!
+   * @brief Create a new entry holding the given value. The entry is placed in
+   *        the small buffer, as long as it has a free slot; otherwise it is
+   *        allocated by the allocator.
+   *
+   * @param value   Value of the new entry.
+   * @return    The new entry, which is not linked into the list yet, or
+   *            nullptr if the allocation failed.
+   */
+  Entry *createEntry(T &value) {
+    typedef typename S::template Entries<typename AbstractList<T, S, I>::template ImmutableEntry<Entry>,
+                                         typename AbstractList<T, S, I>::template MutableEntry<Entry> >
+        Entries;
+    static_assert(K == 0 || (sizeof(Entries) <= InlineEntries<T, 2, K, S>::slotSize && alignof(Entries) <= InlineEntries<T, 2, K, S>::slotAlignment),
+                  "entries do not fit into the small buffer");
+
+    void *memory = this->takeInlineEntry();
+    if (memory == nullptr) {
+      memory = A::allocate(AbstractList<T, S, I>::template getEntrySize<Entry>());
+      if (memory == nullptr) {
+        return nullptr;
       }
+    }
+    return AbstractList<T, S, I>::template constructEntry<Entry>(memory, value);
+  }
+
+  /*!
+   * @brief Delete an entry, created by createEntry(). Inline entries are given
+   *        back to the small buffer, all others to the allocator.
+   *
+   * @param entry   The entry to delete.
+   */
+  void deleteEntry(Entry *entry) {
+    void *memory = AbstractList<T, S, I>::destroyEntry(entry);
+    if (!this->releaseInlineEntry(memory)) {
+      A::deallocate(memory, AbstractList<T, S, I>::template getEntrySize<Entry>());
+    }
+  }
+
+  /*!
+   * @brief Link a new entry between two neighbouring entries.
+   *
+   * @param entry   The new entry.
+   * @param prev    The entry, that should be in front of the new one; nullptr
+   *                to insert at the head.
+   * @param next    The entry, that should be behind the new one; nullptr to
+   *                insert at the tail.
+   */
+  void linkBetween(Entry *entry, Entry *prev, Entry *next) {
+    entry->setPrev(prev);
+    entry->setNext(next);
+    if (prev == nullptr) {
+      head = entry;
+    } else {
+      prev->setNext(entry);
+    }
+    if (next == nullptr) {
+      tail = entry;
+    } else {
+      next->setPrev(entry);
+    }
+  }
+
+  /*!
+   * @brief Unlink an entry from the list and delete it.
+   *
+   * @param toDelete    Entry of this list, that should be removed.
+   * @return    The entry, that was behind the removed one.
+   */
+  Entry *unlinkAndDelete(Entry *toDelete) {
+    Entry *prev = toDelete->getPrev();
+    Entry *next = toDelete->getNext();
+
+    if (prev == nullptr) {
+      head = next;
+    } else {
+      prev->setNext(next);
+    }
+    if (next == nullptr) {
+      tail = prev;
     } else {
-      current = head;
-      for (int i = 0; i < index; i++) {
-        current = current->getNext();
+      next->setPrev(prev);
+    }
+
+    this->deleteEntry(toDelete);
+
+    resetCursor();
+    this->decreaseSize();
+    return next;
+  }
+
+  /*!
+   * @brief Find the entry at the given index. The search starts at the nearest
+   *        finger, which is either the head, the tail or the last visited
+   *        entry. Afterwards, the found entry is the new last visited entry.
+   *
+   * @note  The index must be in the range 0 to getSize() - 1.
+   *
+   * @param index   Index of the entry to find.
+   * @return    The entry at the given index.
+   */
+  Entry *findEntry(I index) {
+    Entry *current = head;
+    I i = 0;
+    I distance = index;
+    if (this->getSize() - 1 - index < distance) {
+      current = tail;
+      i = this->getSize() - 1;
+      distance = i - index;
+    }
+    if (cursor != nullptr) {
+      I cursorDistance = index > cursorIndex ? index - cursorIndex : cursorIndex - index;
+      if (cursorDistance < distance) {
+        current = cursor;
+        i = cursorIndex;
       }
     }
 
-    return current->getValue(this->isMutable());
+    while (i < index) {
+      current = current->getNext();
+      i++;
+    }
+    while (i > index) {
+      current = current->getPrev();
+      i--;
+    }
+
+    cursor = current;
+    cursorIndex = index;
+    return current;
   }
 
  public:
+  /*!
+   * @brief Bidirectional iterator over the entries of the list.
+   *
+   * @note  The iterator walks the entries directly, so a full traversal costs
+   *        O(n) instead of the O(n^2) of an index-based loop with get().
+   * @note  Decrementing end() moves the iterator to the last entry.
+   * @note  Adding or removing entries invalidates iterators pointing to the
+   *        affected entries.
+   */
+  class Iterator {
+    friend class DoubleLinkedList<T, S, I, K, A>;
+
+    Entry *current = nullptr;/// The entry, the iterator points to.
+    DoubleLinkedList<T, S, I, K, A> *list = nullptr;/// The iterated list.
+
+    /*!
+     * @brief Constructor of an Iterator Object.
+     *
+     * @param entry   Entry the iterator points to; nullptr for the end.
+     * @param list    The iterated list.
+     */
+    Iterator(Entry *entry, DoubleLinkedList<T, S, I, K, A> *list)
+        : current(entry), list(list) {}
+
+   public:
+    /*!
+     * @brief Get the value of the entry, the iterator points to.
+     *
+     * @note  Must not be called on the end iterator.
+     *
+     * @return  Reference to the value.
+     */
+    T &operator*() const { return *current->getValue(list->isMutable()); }
+
+    /*!
+     * @brief Access the members of the value, the iterator points to.
+     *
+     * @note  Must not be called on the end iterator.
+     *
+     * @return  Pointer to the value.
+     */
+    T *operator->() const { return current->getValue(list->isMutable()); }
+
+    /*!
+     * @brief Move the iterator to the next entry (prefix).
+     *
+     * @return  Reference to this iterator.
+     */
+    Iterator &operator++() {
+      current = current->getNext();
+      return *this;
+    }
+
+    /*!
+     * @brief Move the iterator to the next entry (postfix).
+     *
+     * @return  Iterator pointing to the entry before the increment.
+     */
+    Iterator operator++(int) {
+      Iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    /*!
+     * @brief Move the iterator to the previous entry (prefix).
+     *
+     * @return  Reference to this iterator.
+     */
+    Iterator &operator--() {
+      current = current == nullptr ? list->tail : current->getPrev();
+      return *this;
+    }
+
+    /*!
+     * @brief Move the iterator to the previous entry (postfix).
+     *
+     * @return  Iterator pointing to the entry before the decrement.
+     */
+    Iterator operator--(int) {
+      Iterator next = *this;
+      --*this;
+      return next;
+    }
+
+    /*!
+     * @brief Compare two iterators whether they point to the same entry.
+     *
+     * @param other   Second iterator to compare.
+     * @return  true if both iterators point to the same entry; false otherwise.
+     */
+    bool operator==(const Iterator &other) const { return current == other.current; }
+
+    /*!
+     * @brief Opposite of '=='
+     *
+     * @param other   Second iterator to compare.
+     * @return  true if the iterators point to different entries; false
+     *          otherwise.
+     */
+    bool operator!=(const Iterator &other) const { return current != other.current; }
+  };
+
+  /*!
+   * @brief Bidirectional iterator over the entries of the list, that walks
+   *        from the last to the first entry.
+   *
+   * @note  Incrementing moves the iterator towards the head of the list.
+   *        Decrementing rend() moves the iterator to the first entry.
+   * @note  Adding or removing entries invalidates iterators pointing to the
+   *        affected entries.
+   */
+  class ReverseIterator {
+    friend class DoubleLinkedList<T, S, I, K, A>;
+
+    Entry *current = nullptr;/// The entry, the iterator points to.
+    DoubleLinkedList<T, S, I, K, A> *list = nullptr;/// The iterated list.
+
+    /*!
+     * @brief Constructor of a ReverseIterator Object.
+     *
+     * @param entry   Entry the iterator points to; nullptr for the end.
+     * @param list    The iterated list.
+     */
+    ReverseIterator(Entry *entry, DoubleLinkedList<T, S, I, K, A> *list)
+        : current(entry), list(list) {}
+
+   public:
+    /*!
+     * @copydoc Iterator::operator*()
+     */
+    T &operator*() const { return *current->getValue(list->isMutable()); }
+
+    /*!
+     * @copydoc Iterator::operator->()
+     */
+    T *operator->() const { return current->getValue(list->isMutable()); }
+
+    /*!
+     * @brief Move the iterator to the previous entry of the list (prefix).
+     *
+     * @return  Reference to this iterator.
+     */
+    ReverseIterator &operator++() {
+      current = current->getPrev();
+      return *this;
+    }
+
+    /*!
+     * @brief Move the iterator to the previous entry of the list (postfix).
+     *
+     * @return  Iterator pointing to the entry before the increment.
+     */
+    ReverseIterator operator++(int) {
+      ReverseIterator next = *this;
+      ++*this;
+      return next;
+    }
+
+    /*!
+     * @brief Move the iterator to the next entry of the list (prefix).
+     *
+     * @return  Reference to this iterator.
+     */
+    ReverseIterator &operator--() {
+      current = current == nullptr ? list->head : current->getNext();
+      return *this;
+    }
+
+    /*!
+     * @brief Move the iterator to the next entry of the list (postfix).
+     *
+     * @return  Iterator pointing to the entry before the decrement.
+     */
+    ReverseIterator operator--(int) {
+      ReverseIterator previous = *this;
+      --*this;
+      return previous;
+    }
+
+    /*!
+     * @copydoc Iterator::operator==()
+     */
+    bool operator==(const ReverseIterator &other) const { return current == other.current; }
+
+    /*!
+     * @copydoc Iterator::operator!=()
+     */
+    bool operator!=(const ReverseIterator &other) const { return current != other.current; }
+  };
+
+  /*!
+   * @brief Opaque handle to one entry of the list.
+   *
+   * @note  A handle stays valid until its entry is removed, regardless of
+   *        other insertions or deletions. It allows to access and remove the
+   *        entry in O(1), e.g. for timer or subscription registries.
+   */
+  class Handle {
+    friend class DoubleLinkedList<T, S, I, K, A>;
+
+    Entry *entry = nullptr;/// The entry, the handle refers to.
+
+    /*!
+     * @brief Constructor of a Handle Object.
+     *
+     * @param entry   Entry the handle refers to.
+     */
+    explicit Handle(Entry *entry) : entry(entry) {}
+
+   public:
+    /*!
+     * @brief Constructor of an invalid Handle Object.
+     */
+    Handle() {}
+
+    /*!
+     * @brief Check if the handle refers to an entry.
+     *
+     * @return  true if the handle refers to an entry; false otherwise.
+     */
+    bool isValid() const { return entry != nullptr; }
+
+    /*!
+     * @brief Compare two handles whether they refer to the same entry.
+     *
+     * @param other   Second handle to compare.
+     * @return  true if both handles refer to the same entry; false otherwise.
+     */
+    bool operator==(const Handle &other) const { return entry == other.entry; }
+
+    /*!
+     * @brief Opposite of '=='
+     *
+     * @param other   Second handle to compare.
+     * @return  true if the handles refer to different entries; false
+     *          otherwise.
+     */
+    bool operator!=(const Handle &other) const { return entry != other.entry; }
+  };
+
+ protected:
+  /*!
+   * @copydoc AbstractList::getPointer()
+   */
+  T *getPointer(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return nullptr;
+    }
+
+    return findEntry(index)->getValue(this->isMutable());
+  }
+
+ public:
+  /*!
+   * @brief   Constructor of a DoubleLinkedList Object. It is immutable, unless the
+   *          storage policy fixes it to be mutable.
+   */
+  DoubleLinkedList() {}
+
   /*!
    * @brief   Constructor of a DoubleLinkedList Object.
    *
-   * @param mutableList true if the list should be mutable; false otherwise
-   *                    (default).
+   * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only lists with the storage policy Storage::Runtime take this
+   *        argument; with Storage::ByValue and Storage::ByReference, it does
+   *        not compile.
    */
-  explicit DoubleLinkedList<T>(bool mutableList = false)
-      : AbstractList<T>(mutableList) {}
+  explicit DoubleLinkedList(bool mutableList)
+      : AbstractList<T, S, I>(mutableList) {}
 
   /*!
    * @brief Destructor of a DoubleLinkedList Object.
    */
   ~DoubleLinkedList() { this->clear(); }
 
-  using AbstractList<T>::addAtIndex;///'Using' the addAtIndex method, to
-                                    /// prevent name hiding of the addAtIndex
-                                    /// method from AbstractList
+  /*!
+   * @brief Get the allocator of the entries, e.g. to configure a stateful
+   *        allocator before adding the first value.
+   *
+   * @return    The allocator of this list.
+   */
+  A &getAllocator() { return *this; }
+
+  /*!
+   * @brief Preallocate the entries for the given number of values, so that
+   *        adding values up to this size does no allocator work.
+   *
+   * @note  Only allocators, that keep memory, like Allocator::Pool and
+   *        Allocator::Arena, can reserve entries. With the default
+   *        Allocator::Heap, nothing is reserved and false is returned, unless
+   *        the free inline entries already suffice.
+   *
+   * @param count   Number of values, the list should hold without
+   *                allocating.
+   * @return    true if adding values up to this size does no allocator work;
+   *            false if the allocator cannot reserve entries or the allocation
+   *            failed.
+   */
+  bool reserve(const I count) {
+    int size = static_cast<int>(this->getSize());
+    int missing = static_cast<int>(count) - size - (size < K ? K - size : 0);
+    if (missing <= 0) {
+      return true;
+    }
+    return Allocator::Traits<A>::reserve(*this, missing, AbstractList<T, S, I>::template getEntrySize<Entry>());
+  }
+
+  /*!
+   * @brief Get an iterator pointing to the first entry of the list.
+   *
+   * @return  Iterator to the first entry, or end() if the list is empty.
+   */
+  Iterator begin() { return Iterator(head, this); }
+
+  /*!
+   * @brief Get an iterator pointing behind the last entry of the list.
+   *
+   * @return  Iterator marking the end of the list.
+   */
+  Iterator end() { return Iterator(nullptr, this); }
+
+  /*!
+   * @brief Get a reverse iterator pointing to the last entry of the list.
+   *
+   * @return  Reverse iterator to the last entry, or rend() if the list is
+   *          empty.
+   */
+  ReverseIterator rbegin() { return ReverseIterator(tail, this); }
+
+  /*!
+   * @brief Get a reverse iterator pointing before the first entry of the list.
+   *
+   * @return  Reverse iterator marking the end of the reverse traversal.
+   */
+  ReverseIterator rend() { return ReverseIterator(nullptr, this); }
+
+  using AbstractList<T, S, I>::addAtIndex;///'Using' the addAtIndex method, to
+                                       /// prevent name hiding of the addAtIndex
+                                       /// method from AbstractList
 
   /*!
    * @copydoc AbstractList::addAtIndex()
    */
-  void addAtIndex(int index, T &value) override {
+  void addAtIndex(I index, T &value) override {
     // it is allowed, that index == this->getSize() to insert it behind the last
     // entry
-    if (extendedIsIndexOutOfBounds(index)) {
+    if (extendedIsIndexOutOfBounds(index) || this->isSizeLimitReached()) {
       return;
     }
 
-    Entry *entry = new Entry();
-    entry->setValue(value, this->isMutable());
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return;// the allocation failed
+    }
 
-    if (index == 0) {
-      if (this->getSize() == 0) {
-        // Add entry to an empty list
-        tail = entry;
-      } else {
-        // Add entry to not empty list
-        entry->setNext(head);
-        head->setPrev(entry);
-      }
-      head = entry;
-    } else if (index == this->getSize()) {
-      // Add entry at not empty list but at last position
-      tail->setNext(entry);
-      entry->setPrev(tail);
-      tail = entry;
+    if (index == this->getSize()) {
+      linkBetween(entry, tail, nullptr);
     } else {
-      // Add entry to a not empty list, somewhere in the middle
-      Entry *current;
-
-      // optimize searching in large lists
-      if (index >= abs(this->getSize() / 2)) {
-        current = tail;
-        for (int i = this->getSize(); i > index + 1; --i) {
-          current = current->getPrev();
-        }
-        entry->setNext(current);
-        entry->setPrev(current->getPrev());
-        entry->getPrev()->setNext(entry);
-        current->setPrev(entry);
-      } else {
-        current = head;
-        for (int i = 0; i < index - 1; ++i) {
-          current = current->getNext();
-        }
-        entry->setNext(current->getNext());
-        entry->setPrev(current);
-        entry->getNext()->setPrev(entry);
-        current->setNext(entry);
-      }
+      Entry *next = findEntry(index);
+      linkBetween(entry, next->getPrev(), next);
+      // the new entry takes over the index of the found entry
+      cursor = entry;
     }
 
     this->increaseSize();
   };
 
   /*!
-   * @copydoc AbstractList::clear()
+   * @brief Add the value in front of the entry, the iterator points to.
+   *
+   * @note  Runs in O(1), because no search is necessary.
+   * @note  Inserting in front of end() adds the value at the end of the list.
+   * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
+   * @note  If the size limit of the index type is reached or the allocation
+   *        fails, nothing happen and the given iterator is returned.
+   *
+   * @param position    Iterator of this list, in front of which the value
+   *                    should be added.
+   * @param value   Value of the new entry.
+   * @return    Iterator pointing to the new entry.
    */
-  void clear() override {
-    if (this->getSize() == 0) {
-      return;
+  Iterator insertBefore(const Iterator &position, T &value) {
+    if (this->isSizeLimitReached()) {
+      return position;
     }
 
-    Entry *current = head;
-    Entry *next;
-    for (int i = 0; i < this->getSize(); ++i) {
-      next = current->getNext();
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return position;// the allocation failed
+    }
+    Entry *prev = position.current == nullptr ? tail : position.current->getPrev();
+    linkBetween(entry, prev, position.current);
+
+    resetCursor();
+    this->increaseSize();
+    return Iterator(entry, this);
+  }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @copydoc DoubleLinkedList::insertBefore()
+   * @note If the list is mutable nothing happen and the given iterator is
+   * returned.
+   */
+  Iterator insertBefore(const Iterator &position, T &&value) {
+    if (this->isMutable()) {
+      return position;// Mutable lists cannot save rvalues!
+    }
+    return insertBefore(position, value);
+  }
+#endif
 
-      delete current;
-      current = next;
+  /*!
+   * @brief Add the value behind the entry, the iterator points to.
+   *
+   * @note  Runs in O(1), because no search is necessary.
+   * @note  The iterator must not be end().
+   * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
+   * @note  If the size limit of the index type is reached or the allocation
+   *        fails, nothing happen and the given iterator is returned.
+   *
+   * @param position    Iterator of this list, behind which the value should be
+   *                    added.
+   * @param value   Value of the new entry.
+   * @return    Iterator pointing to the new entry.
+   */
+  Iterator insertAfter(const Iterator &position, T &value) {
+    if (this->isSizeLimitReached()) {
+      return position;
     }
 
-    this->resetSize();
-    head = nullptr;
-    tail = nullptr;
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return position;// the allocation failed
+    }
+    linkBetween(entry, position.current, position.current->getNext());
+
+    resetCursor();
+    this->increaseSize();
+    return Iterator(entry, this);
   }
 
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
   /*!
-   * @copydoc AbstractList::remove()
+   * @copydoc DoubleLinkedList::insertAfter()
+   * @note If the list is mutable nothing happen and the given iterator is
+   * returned.
    */
-  void remove(int index) override {
-    if (this->isIndexOutOfBounds(index)) {
-      return;
+  Iterator insertAfter(const Iterator &position, T &&value) {
+    if (this->isMutable()) {
+      return position;// Mutable lists cannot save rvalues!
     }
+    return insertAfter(position, value);
+  }
+#endif
 
-    Entry *current = head;
+  /*!
+   * @brief Remove the entry, the iterator points to.
+   *
+   * @note  Runs in O(1), because no search is necessary.
+   * @note  The iterator must not be end(). Only iterators pointing to the
+   *        removed entry become invalid.
+   *
+   * @param position    Iterator of this list pointing to the entry to remove.
+   * @return    Iterator pointing to the entry behind the removed one.
+   */
+  Iterator erase(const Iterator &position) {
+    return Iterator(unlinkAndDelete(position.current), this);
+  }
 
-    // optimize searching in large lists
-    if (index >= abs(this->getSize() / 2)) {
-      if (index != 0) {
-        current = tail;
-        int i = this->getSize() - 1;
-        while (i > index - 1) {
-          current = current->getPrev();
-          --i;
-        }
-      }
-    } else {
-      if (index != 0) {
-        int i = 0;
-        while (i < index - 1) {
-          current = current->getNext();
-          i++;
-        }
-      }
+  /*!
+   * @brief Add a new entry at the beginning of the list and get a handle to
+   *        it.
+   *
+   * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
+   * @note  If the size limit of the index type is reached or the allocation
+   *        fails, nothing happen and an invalid handle is returned.
+   *
+   * @param value   Value to add.
+   * @return    Handle to the new entry.
+   */
+  Handle addFirstWithHandle(T &value) {
+    if (this->isSizeLimitReached()) {
+      return Handle();
+    }
+
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return Handle();// the allocation failed
+    }
+    linkBetween(entry, nullptr, head);
+
+    resetCursor();
+    this->increaseSize();
+    return Handle(entry);
+  }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @copydoc DoubleLinkedList::addFirstWithHandle()
+   * @note If the list is mutable nothing happen and an invalid handle is
+   * returned.
+   */
+  Handle addFirstWithHandle(T &&value) {
+    if (this->isMutable()) {
+      return Handle();// Mutable lists cannot save rvalues!
     }
+    return addFirstWithHandle(value);
+  }
+#endif
+
+  /*!
+   * @brief Add a new entry at the end of the list and get a handle to it.
+   *
+   * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
+   * @note  If the size limit of the index type is reached or the allocation
+   *        fails, nothing happen and an invalid handle is returned.
+   *
+   * @param value   Value to add.
+   * @return    Handle to the new entry.
+   */
+  Handle addLastWithHandle(T &value) {
+    if (this->isSizeLimitReached()) {
+      return Handle();
+    }
+
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return Handle();// the allocation failed
+    }
+    linkBetween(entry, tail, nullptr);
+
+    this->increaseSize();
+    return Handle(entry);
+  }
 
-    if (index == this->getSize() - 1) {
-      tail = current;
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @copydoc DoubleLinkedList::addLastWithHandle()
+   * @note If the list is mutable nothing happen and an invalid handle is
+   * returned.
+   */
+  Handle addLastWithHandle(T &&value) {
+    if (this->isMutable()) {
+      return Handle();// Mutable lists cannot save rvalues!
     }
+    return addLastWithHandle(value);
+  }
+#endif
+
+  using AbstractList<T, S, I>::get;///'Using' the get method, to prevent name hiding
+                                /// of the get method from AbstractList
+
+  /*!
+   * @brief Get a reference to the value of the entry, the handle refers to.
+   *
+   * @note  Runs in O(1), because no search is necessary.
+   * @note  The handle must be valid and its entry must not be removed yet.
+   *
+   * @param handle  Handle of an entry of this list.
+   * @return    Reference to the value.
+   */
+  T &get(const Handle &handle) { return *handle.entry->getValue(this->isMutable()); }
 
-    if (index == 0) {
-      head = current->getNext();
+  /*!
+   * @brief Remove the entry, the handle refers to.
+   *
+   * @note  Runs in O(1), because no search is necessary.
+   * @note  The handle must be valid and its entry must not be removed yet.
+   * Afterwards, the handle must not be used anymore.
+   *
+   * @param handle  Handle of an entry of this list.
+   */
+  void remove(const Handle &handle) { unlinkAndDelete(handle.entry); }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @brief Call the given function for every value of the list, from the first
+   *        to the last entry.
+   *
+   * @note  The entries are walked directly and the function is inlined, so
+   *        neither a virtual call nor a copy of the value happens per entry.
+   * @note  The function must not add or remove entries of this list.
+   *
+   * @tparam F  Type of the function, callable with T&.
+   * @param function    Function, lambda or functor to call with a reference to
+   *                    each value.
+   */
+  template<typename F>
+  void forEach(F &&function) {
+    const bool mutableList = this->isMutable();
+    for (Entry *current = head; current != nullptr; current = current->getNext()) {
+      function(*current->getValue(mutableList));
     }
+  }
+#endif
 
-    Entry *toDelete;
-    if (index == 0) {
-      toDelete = current;
-      head = current->getNext();
+  /*!
+   * @copydoc AbstractList::clear()
+   * @note  With a resettable allocator (like Allocator::Arena), the entries
+   *        are only visited, if the values have to be destroyed.
+   */
+  void clear() override {
+    Entry *current = head;
+    Entry *next;
+    if (Allocator::Traits<A>::resettable) {
+      // the allocator frees all entries at once, so only the values have to be
+      // destroyed. The reset is needed even for an empty list, because
+      // removed entries are not given back to a resettable allocator.
+      if (!this->isMutable() && !AbstractList<T, S, I>::isTriviallyDestructible()) {
+        for (I i = 0; i < this->getSize(); ++i) {
+          next = current->getNext();
+
+          AbstractList<T, S, I>::destroyEntry(current);
+          current = next;
+        }
+      }
+      this->resetInlineEntries();
+      Allocator::Traits<A>::reset(*this);
     } else {
-      toDelete = current->getNext();
-      current->setNext(current->getNext()->getNext());
-      if (current->getNext() != nullptr) {
-        current->getNext()->setPrev(current);
+      for (I i = 0; i < this->getSize(); ++i) {
+        next = current->getNext();
+
+        this->deleteEntry(current);
+        current = next;
       }
     }
 
-    delete toDelete;
+    this->resetSize();
+    head = nullptr;
+    tail = nullptr;
+    resetCursor();
+  }
 
-    this->decreaseSize();
+  /*!
+   * @copydoc AbstractList::remove()
+   */
+  void remove(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return;
+    }
 
-    if (this->getSize() == 0) {
-      head = nullptr;
-      tail = nullptr;
+    Entry *next = unlinkAndDelete(findEntry(index));
+    if (next != nullptr) {
+      // the next entry takes over the index of the removed entry
+      cursor = next;
+      cursorIndex = index;
     }
   }
 };
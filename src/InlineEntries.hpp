@@ -0,0 +1,161 @@
+/*!
+ * @file InlineEntries.hpp
+ *
+ * This file is part of the List library. It extends the arduino ecosystem with
+ * easy-to-use list implementations. They are specially designed and optimized
+ * for different purposes.
+ *
+ * Copyright (C) 2024  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef LIST_INLINE_ENTRIES_HPP
+#define LIST_INLINE_ENTRIES_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * @brief   Memory for the first K entries of a linked list, stored inside the
+ *          list object. The linked lists take entries from here before they
+ *          allocate on the heap, so short lists do not allocate at all.
+ *
+ * @tparam T        Data Type of entries, that should be stored in the list.
+ * @tparam Links    Number of links (pointers) of an entry.
+ * @tparam K        Number of inline entries.
+ * @tparam S        Storage policy of the list (see Storage). The slots only
+ *                  fit the entries, the policy can create: copies of the
+ *                  values for Storage::ByValue, pointers for
+ *                  Storage::ByReference and the larger of both for
+ *                  Storage::Runtime.
+ */
+template<typename T, int Links, int K, typename S>
+class InlineEntries {
+  /*!
+   * @brief Layout of an entry, that holds a copy of the value.
+   */
+  struct ImmutableLayout {
+    void *links[Links];/// The links to the neighbours.
+    T value;/// The raw value.
+  };
+
+  /*!
+   * @brief Layout of an entry, that holds a pointer to the value.
+   */
+  struct MutableLayout {
+    void *links[Links];/// The links to the neighbours.
+    T *value;/// A pointer to the raw value.
+  };
+
+  /*!
+   * @brief Memory for one entry. A free slot links to the next free slot.
+   */
+  union Slot {
+    typename S::template Entries<ImmutableLayout, MutableLayout> layout;/// Size and alignment of the entries.
+    Slot *nextFree;/// The next free slot, while this slot is free.
+
+    Slot() : nextFree(nullptr) {}
+    ~Slot() {}
+  };
+
+  Slot slots[K];/// The inline memory.
+  Slot *freeList;/// The first free slot; nullptr if all slots are used.
+
+ public:
+  static const size_t slotSize = sizeof(Slot);/// Size of the memory for one entry.
+  static const size_t slotAlignment = alignof(Slot);/// Alignment of the memory for one entry.
+
+  /*!
+   * @brief Constructor of an InlineEntries Object. All slots are free.
+   */
+  InlineEntries() { resetInlineEntries(); }
+
+  /*!
+   * @brief Mark all slots as free at once, without destroying their entries.
+   */
+  void resetInlineEntries() {
+    for (int i = 0; i < K - 1; ++i) {
+      slots[i].nextFree = &slots[i + 1];
+    }
+    slots[K - 1].nextFree = nullptr;
+    freeList = slots;
+  }
+
+  /*!
+   * @brief Take a free slot.
+   *
+   * @return    Memory for one entry, or nullptr if all slots are used.
+   */
+  void *takeInlineEntry() {
+    Slot *slot = freeList;
+    if (slot != nullptr) {
+      freeList = slot->nextFree;
+    }
+    return slot;
+  }
+
+  /*!
+   * @brief Give the memory of a destroyed entry back, if it is a slot.
+   *
+   * @param memory  Memory of a destroyed entry.
+   * @return    true if the memory is a slot, which is free again; false if the
+   *            memory was not taken from here.
+   */
+  bool releaseInlineEntry(void *memory) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(memory);
+    if (address < reinterpret_cast<uintptr_t>(slots) || address >= reinterpret_cast<uintptr_t>(slots + K)) {
+      return false;
+    }
+
+    Slot *slot = static_cast<Slot *>(memory);
+    slot->nextFree = freeList;
+    freeList = slot;
+    return true;
+  }
+};
+
+/*!
+ * @brief   Specialization without inline entries. It is empty, so it does not
+ *          increase the size of the list.
+ *
+ * @tparam T        Data Type of entries, that should be stored in the list.
+ * @tparam Links    Number of links (pointers) of an entry.
+ * @tparam S        Storage policy of the list (see Storage).
+ */
+template<typename T, int Links, typename S>
+class InlineEntries<T, Links, 0, S> {
+ public:
+  static const size_t slotSize = 0;/// Size of the memory for one entry.
+  static const size_t slotAlignment = 0;/// Alignment of the memory for one entry.
+
+  /*!
+   * @copydoc InlineEntries::takeInlineEntry()
+   */
+  void *takeInlineEntry() { return nullptr; }
+
+  /*!
+   * @copydoc InlineEntries::releaseInlineEntry()
+   */
+  bool releaseInlineEntry(void *) { return false; }
+
+  /*!
+   * @copydoc InlineEntries::resetInlineEntries()
+   */
+  void resetInlineEntries() {}
+};
+
+#endif// LIST_INLINE_ENTRIES_HPP
@@ -49,20 +49,34 @@
  * @brief   A list with the most basic implementation as a single-linked list.
  *
  * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam S    Storage policy (see Storage). Use Storage::ByValue or
+ *              Storage::ByReference to fix the mutability at compile time.
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ * @tparam K    Number of entries, that are stored inside the list object
+ *              (see SingleLinkedList).
+ * @tparam A    Allocator of the entries (see Allocator).
  */
-template<typename T>
-class List : public SingleLinkedList<T> {
+template<typename T, typename S = Storage::Runtime, typename I = int, int K = 0, typename A = Allocator::Heap>
+class List : public SingleLinkedList<T, S, I, K, A> {
  public:
+  /*!
+   * @brief Constructor of a List Object. It is immutable, unless the
+   *        storage policy fixes it to be mutable.
+   */
+  List() {}
+
   /*!
    * @brief Constructor of a List Object.
    *
-   * @param mutableList true if the list should be mutable; false otherwise
-   *                    (default).
+   * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only lists with the storage policy Storage::Runtime take this
+   *        argument; with Storage::ByValue and Storage::ByReference, it does
+   *        not compile.
    * @note  Mutable lists only work as expected, if the values, that are added, are
    *        only lvalues and you can ensure, that the variables do not go out-of-scope during all operations of the list.
    */
-  explicit List<T>(bool mutableList = false)
-      : SingleLinkedList<T>(mutableList) {}
+  explicit List(bool mutableList)
+      : SingleLinkedList<T, S, I, K, A>(mutableList) {}
 };
 
 #endif// LIST_HPP
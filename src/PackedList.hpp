@@ -0,0 +1,304 @@
+/*!
+ * @file PackedList.hpp
+ *
+ * This file is part of the List library. It extends the arduino ecosystem with
+ * easy-to-use list implementations. They are specially designed and optimized
+ * for different purposes.
+ *
+ * Copyright (C) 2024  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef LIST_PACKED_LIST_HPP
+#define LIST_PACKED_LIST_HPP
+
+#include <stdint.h>
+
+#include "AbstractList.hpp"
+
+/*!
+ * @brief   Implementation of a list of small unsigned integers, that packs
+ *          the values with Bits bits each into 32-bit words. The words are
+ *          allocated in blocks, which never move once allocated. Adding and
+ *          removing shifts the following values a whole word at a time.
+ *
+ * @note    The list is always immutable. Values are unpacked on access, so
+ *          there is no storage, a pointer or reference could refer to. Use
+ *          get() and getMany() with an array of values, which return
+ *          copies; at(), front(), back() and getMany() with an array of
+ *          pointers are not available.
+ * @note    Only the lowest Bits bits of added values are stored.
+ * @note    Use PackedList<1, bool> for a list of booleans, that stores one
+ *          bit per value. List<bool> stays a linked list of entries.
+ *
+ * @tparam Bits Number of bits per value: 1, 2, 4 or 8.
+ * @tparam T    Data Type of the values (default uint8_t).
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ */
+template<int Bits, typename T = uint8_t, typename I = int>
+class PackedList : public AbstractList<T, Storage::ByValue, I> {
+  static_assert(Bits == 1 || Bits == 2 || Bits == 4 || Bits == 8, "PackedList supports 1, 2, 4 or 8 bits per value");
+
+  typedef uint32_t Word;
+
+  static const int wordBits = 32;/// Number of bits of a word.
+  static const int valuesPerWord = wordBits / Bits;/// Number of values of a word.
+  static const int blockWords = 8;/// Number of words of a block.
+  static const int valuesPerBlock = valuesPerWord * blockWords;/// Number of values of a block.
+  static const Word valueMask = (static_cast<Word>(1) << Bits) - 1;/// Mask of the lowest value of a word.
+
+  Word **blocks = nullptr;/// The allocated blocks, in the order of the values.
+  int blockCount = 0;/// Number of allocated blocks.
+  int blockCapacity = 0;/// Number of elements of the blocks array.
+  T scratch = T();/// Unpacked copy of the value, last returned by getPointer(); only used for copies.
+
+  /*!
+   * @brief Get the word at the given position of all words of the list.
+   *
+   * @param position    Position of the word.
+   * @return    Reference to the word.
+   */
+  Word &getWord(const int position) { return blocks[position / blockWords][position % blockWords]; }
+
+  /*!
+   * @brief Get a word, that holds the given value at every position.
+   *
+   * @param value   Value to repeat.
+   * @return    Word with the repeated value.
+   */
+  static Word repeat(const Word value) {
+    Word pattern = 0;
+    for (int i = 0; i < valuesPerWord; ++i) {
+      pattern = (pattern << Bits) | value;
+    }
+    return pattern;
+  }
+
+  /*!
+   * @brief Get a mask of the bits of the first values of a word.
+   *
+   * @param count   Number of values, in the range 0 to valuesPerWord.
+   * @return    Mask of the bits of these values.
+   */
+  static Word lowBits(const int count) {
+    if (count >= valuesPerWord) {
+      return ~static_cast<Word>(0);
+    }
+    return (static_cast<Word>(1) << (count * Bits)) - 1;
+  }
+
+  /*!
+   * @brief Compare all values of a word with the given value at once.
+   *
+   * @param word    The word.
+   * @param value   Value to compare with.
+   * @return    Word, in which the lowest bit of every equal value is set.
+   */
+  static Word matches(const Word word, const T value) {
+    Word diff = word ^ repeat(static_cast<Word>(value) & valueMask);
+    Word nonZero = 0;
+    for (int i = 0; i < Bits; ++i) {
+      nonZero |= diff >> i;
+    }
+    return ~nonZero & repeat(1);
+  }
+
+  /*!
+   * @brief Append a new block filled with zeros.
+   *
+   * @return    true if the block was appended; false if the allocation failed.
+   */
+  bool addBlock() {
+    if (blockCount == blockCapacity) {
+      int newCapacity = blockCapacity == 0 ? 4 : blockCapacity * 2;
+      Word **newBlocks = new (std::nothrow) Word *[newCapacity];
+      if (newBlocks == nullptr) {
+        return false;
+      }
+      for (int i = 0; i < blockCount; ++i) {
+        newBlocks[i] = blocks[i];
+      }
+      delete[] blocks;
+      blocks = newBlocks;
+      blockCapacity = newCapacity;
+    }
+    Word *block = new (std::nothrow) Word[blockWords]();
+    if (block == nullptr) {
+      return false;
+    }
+    blocks[blockCount++] = block;
+    return true;
+  }
+
+ protected:
+  /*!
+   * @copydoc AbstractList::getPointer()
+   * @note  The returned pointer refers to an unpacked copy of the value, that
+   *        is overwritten by the next call. It is only used to copy the value.
+   */
+  T *getPointer(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return nullptr;
+    }
+
+    Word word = getWord(index / valuesPerWord);
+    scratch = static_cast<T>((word >> ((index % valuesPerWord) * Bits)) & valueMask);
+    return &scratch;
+  }
+
+ public:
+  /*!
+   * @brief Constructor of a PackedList Object. Packed lists are always
+   *        immutable, so there is no mutability argument.
+   */
+  PackedList() {}
+
+  /*!
+   * @brief Destructor of a PackedList Object.
+   */
+  ~PackedList() { this->clear(); }
+
+  /*!
+   * @brief Count the values, that are equal to the given one. A whole word is
+   *        compared at once.
+   *
+   * @param value   Value to count.
+   * @return    Number of equal values.
+   */
+  I count(const T value) {
+    I found = 0;
+    int words = (this->getSize() + valuesPerWord - 1) / valuesPerWord;
+    for (int i = 0; i < words; ++i) {
+      Word equal = matches(getWord(i), value) & lowBits(this->getSize() - i * valuesPerWord);
+      found += __builtin_popcountl(equal);
+    }
+    return found;
+  }
+
+  /*!
+   * @brief Find the first value, that is equal to the given one. A whole word
+   *        is compared at once.
+   *
+   * @param value   Value to search for.
+   * @return    Index of the first equal value, or -1 if there is none.
+   */
+  int findFirst(const T value) {
+    int words = (this->getSize() + valuesPerWord - 1) / valuesPerWord;
+    for (int i = 0; i < words; ++i) {
+      Word equal = matches(getWord(i), value) & lowBits(this->getSize() - i * valuesPerWord);
+      if (equal != 0) {
+        return i * valuesPerWord + __builtin_ctzl(equal) / Bits;
+      }
+    }
+    return -1;
+  }
+
+  /*!
+   * @copydoc AbstractList::getMany(const I *, size_t, T *)
+   */
+  size_t getMany(const I *indices, const size_t n, T *out) {
+    return AbstractList<T, Storage::ByValue, I>::getMany(indices, n, out);
+  }
+
+  /*!
+   * @brief Not available, because the values are unpacked on access, so there
+   *        is no storage, a pointer or reference could refer to.
+   */
+  size_t getMany(const I *indices, size_t n, T **out) = delete;
+  T &at(I index) = delete;
+  const T &at(I index) const = delete;
+  T &front() = delete;
+  const T &front() const = delete;
+  T &back() = delete;
+  const T &back() const = delete;
+
+  using AbstractList<T, Storage::ByValue, I>::addAtIndex;///'Using' the addAtIndex method, to
+                                                         /// prevent name hiding of the
+                                                         /// addAtIndex method from AbstractList
+
+  /*!
+   * @copydoc AbstractList::addAtIndex()
+   */
+  void addAtIndex(I index, T &value) override {
+    // it is allowed, that index == this->getSize() to insert it behind the last
+    // entry
+    if (extendedIsIndexOutOfBounds(index) || this->isSizeLimitReached()) {
+      return;
+    }
+
+    if (this->getSize() == blockCount * valuesPerBlock && !addBlock()) {
+      return;// the allocation failed
+    }
+
+    // move every value behind the index up by one position, carrying the
+    // highest value of a word into the next word
+    int first = index / valuesPerWord;
+    for (int i = this->getSize() / valuesPerWord; i > first; --i) {
+      getWord(i) = (getWord(i) << Bits) | (getWord(i - 1) >> (wordBits - Bits));
+    }
+
+    int offset = index % valuesPerWord;
+    Word keep = lowBits(offset);
+    Word &word = getWord(first);
+    word = (word & keep) | ((word & ~keep) << Bits) | ((static_cast<Word>(value) & valueMask) << (offset * Bits));
+
+    this->increaseSize();
+  }
+
+  /*!
+   * @copydoc AbstractList::clear()
+   */
+  void clear() override {
+    for (int i = 0; i < blockCount; ++i) {
+      delete[] blocks[i];
+    }
+    delete[] blocks;
+
+    blocks = nullptr;
+    blockCount = 0;
+    blockCapacity = 0;
+    this->resetSize();
+  }
+
+  /*!
+   * @copydoc AbstractList::remove()
+   * @note  The blocks are kept until clear() is called.
+   */
+  void remove(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return;
+    }
+
+    // move every value behind the index down by one position, carrying the
+    // lowest value of a word into the previous word
+    int first = index / valuesPerWord;
+    int last = (this->getSize() - 1) / valuesPerWord;
+
+    Word keep = lowBits(index % valuesPerWord);
+    Word &word = getWord(first);
+    word = (word & keep) | ((word >> Bits) & ~keep);
+
+    for (int i = first; i < last; ++i) {
+      getWord(i) |= (getWord(i + 1) & valueMask) << (wordBits - Bits);
+      getWord(i + 1) >>= Bits;
+    }
+
+    this->decreaseSize();
+  }
+};
+
+#endif// LIST_PACKED_LIST_HPP
@@ -27,21 +27,39 @@
 #define LIST_SINGLE_LINKED_LIST_HPP
 
 #include "AbstractList.hpp"
+#include "Allocator.hpp"
+#include "InlineEntries.hpp"
 
 /*!
  * @brief   Implementation of a single-linked list.
  *
  * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam S    Storage policy (see Storage).
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ * @tparam K    Number of entries, that are stored inside the list object
+ *              before entries are allocated (default 0).
+ * @tparam A    Allocator of the entries (see Allocator).
  */
-template<typename T>
-class SingleLinkedList : public AbstractList<T> {
+template<typename T, typename S = Storage::Runtime, typename I = int, int K = 0, typename A = Allocator::Heap>
+class SingleLinkedList : public AbstractList<T, S, I>, private InlineEntries<T, 1, K, S>, private A {
   /*!
    * @brief Class representing one entry of the list.
    */
-  class Entry : public AbstractList<T>::AbstractEntry {
+  class Entry {
     Entry *next = nullptr;/// Pointer to the next element of the list
 
    public:
+    /*!
+     * @brief   Get a pointer to the value (mutable or immutable).
+     *
+     * @note    The entry must be created by AbstractList::createEntry().
+     *
+     * @param m   Indicates, if the list is mutable or immutable.
+     *
+     * @return  Pointer to the value of the entry.
+     */
+    T *getValue(const bool m) { return AbstractList<T, S, I>::getEntryValue(this, m); }
+
     /*!
      * @brief   Destructor of an Entry Object.
      */
@@ -62,60 +80,469 @@ class SingleLinkedList : public AbstractList<T> {
     void setNext(Entry *nextEntry) { next = nextEntry; }
   };
 
+  // the index is declared first, so it fills the padding behind the size of
+  // the list instead of adding its own
+  I cursorIndex = 0;/// The index of the last visited entry.
   Entry *head = nullptr;/// The first entry of the list.
   Entry *tail = nullptr;/// The last entry of the list.
+  Entry *cursor = nullptr;/// The last entry visited by getPointer().
 
- protected:
   /*!
-   * @copydoc AbstractList::getPointer()
+   * @brief Optional index, that samples every k-th entry of the list.
+   *
+   * @note  The samples are kept sorted by their index. Insertions and
+   *        deletions shift the stored indices, so the sampled entries stay
+   *        valid. If the gaps between the samples became too large, the index
+   *        is rebuilt on the next lookup.
    */
-  T *getPointer(int index) override {
-    if (this->isIndexOutOfBounds(index)) {
-      return nullptr;
+  struct SkipIndex {
+    /*!
+     * @brief One sampled entry.
+     */
+    struct Sample {
+      Entry *entry;/// The sampled entry.
+      I index;/// The current index of the sampled entry.
+    };
+
+    Sample *samples = nullptr;/// Samples, sorted by their index.
+    int count = 0;/// Number of valid samples.
+    int capacity = 0;/// Number of allocated samples.
+    int stride = 0;/// Intended distance between two samples.
+
+    /*!
+     * @brief Destructor of a SkipIndex Object.
+     */
+    ~SkipIndex() { delete[] samples; }
+
+    /*!
+     * @brief Find the sample with the largest index, that is not greater than
+     *        the given index.
+     *
+     * @param index   Index to search for.
+     * @return    The found sample, or nullptr if there is none.
+     */
+    Sample *find(const I index) {
+      int low = 0;
+      int high = count - 1;
+      Sample *found = nullptr;
+      while (low <= high) {
+        int middle = low + (high - low) / 2;
+        if (samples[middle].index <= index) {
+          found = &samples[middle];
+          low = middle + 1;
+        } else {
+          high = middle - 1;
+        }
+      }
+      return found;
+    }
+
+    /*!
+     * @brief Update the samples after an entry was added at the given index.
+     *
+     * @param index   Index of the new entry.
+     */
+    void inserted(const I index) {
+      for (int i = count - 1; i >= 0 && samples[i].index >= index; --i) {
+        samples[i].index++;
+      }
+    }
+
+    /*!
+     * @brief Update the samples after the entry at the given index was
+     *        removed. A sample of the removed entry is dropped.
+     *
+     * @param index   Index of the removed entry.
+     */
+    void removed(const I index) {
+      for (int i = count - 1; i >= 0 && samples[i].index >= index; --i) {
+        if (samples[i].index == index) {
+          for (int j = i; j < count - 1; ++j) {
+            samples[j] = samples[j + 1];
+          }
+          count--;
+        } else {
+          samples[i].index--;
+        }
+      }
+    }
+  };
+
+  SkipIndex *skipIndex = nullptr;/// Optional skip index; nullptr if disabled.
+
+  /*!
+   * @brief Forget the last visited entry. Must be called after every
+   *        structural change, that could move or delete the cursor entry.
+   */
+  void resetCursor() {
+    cursor = nullptr;
+    cursorIndex = 0;
+  }
+
+  /*!
+   * @brief Drop all samples of the skip index, if enabled. Must be called
+   *        after structural changes, whose index is unknown.
+   */
+  void invalidateSkipIndex() {
+    if (skipIndex != nullptr) {
+      skipIndex->count = 0;
     }
+  }
 
+  /*!
+   * @brief Sample every k-th entry of the list into the skip index.
+   *
+   * @return    true if the index was rebuilt; false if the samples could not
+   *            be allocated, leaving the index empty.
+   */
+  bool rebuildSkipIndex() {
+    int needed = (this->getSize() + skipIndex->stride - 1) / skipIndex->stride;
+    if (needed > skipIndex->capacity) {
+      delete[] skipIndex->samples;
+      skipIndex->samples = new (std::nothrow) typename SkipIndex::Sample[needed];
+      skipIndex->capacity = skipIndex->samples == nullptr ? 0 : needed;
+      if (skipIndex->samples == nullptr) {
+        skipIndex->count = 0;
+        return false;
+      }
+    }
+
+    skipIndex->count = 0;
+    int untilNextSample = 0;
+    I i = 0;
+    for (Entry *current = head; current != nullptr; current = current->getNext()) {
+      if (untilNextSample == 0) {
+        skipIndex->samples[skipIndex->count].entry = current;
+        skipIndex->samples[skipIndex->count].index = i;
+        skipIndex->count++;
+        untilNextSample = skipIndex->stride;
+      }
+      untilNextSample--;
+      i++;
+    }
+    return true;
+  }
+
+  /*!
+   * @brief Find the entry at the given index. The search starts at the
+   *        nearest preceding known entry, which is either the head, the last
+   *        visited entry or a sample of the skip index. Afterwards, the found
+   *        entry is the new last visited entry.
+   *
+   * @note  The index must be in the range 0 to getSize() - 1.
+   *
+   * @param index   Index of the entry to find.
+   * @return    The entry at the given index.
+   */
+  Entry *findEntry(I index) {
     Entry *current = head;
-    int i = 0;
+    I i = 0;
+    if (index == this->getSize() - 1) {
+      current = tail;
+      i = index;
+    } else {
+      if (cursor != nullptr && cursorIndex <= index) {
+        // continue from the last visited entry, so sequential access is
+        // amortized O(1)
+        current = cursor;
+        i = cursorIndex;
+      }
+      if (skipIndex != nullptr) {
+        typename SkipIndex::Sample *sample = skipIndex->find(index);
+        if (sample != nullptr && sample->index > i) {
+          current = sample->entry;
+          i = sample->index;
+        }
+        if (static_cast<int>(index - i) > 2 * skipIndex->stride && rebuildSkipIndex()) {
+          // the samples are missing or too sparse here
+          sample = skipIndex->find(index);
+          current = sample->entry;
+          i = sample->index;
+        }
+      }
+    }
+
     while (i != index) {
       current = current->getNext();
       i++;
     }
-    return current->getValue(this->isMutable());
+
+    cursor = current;
+    cursorIndex = index;
+    return current;
+  }
+
+  /*!
+   * @brief Create a new entry holding the given value. The entry is placed in
+   *        the small buffer, as long as it has a free slot; otherwise it is
+   *        allocated by the allocator.
+   *
+   * @param value   Value of the new entry.
+   * @return    The new entry, which is not linked into the list yet, or
+   *            nullptr if the allocation failed.
+   */
+  Entry *createEntry(T &value) {
+    typedef typename S::template Entries<typename AbstractList<T, S, I>::template ImmutableEntry<Entry>,
+                                         typename AbstractList<T, S, I>::template MutableEntry<Entry> >
+        Entries;
+    static_assert(K == 0 || (sizeof(Entries) <= InlineEntries<T, 1, K, S>::slotSize && alignof(Entries) <= InlineEntries<T, 1, K, S>::slotAlignment),
+                  "entries do not fit into the small buffer");
+
+    void *memory = this->takeInlineEntry();
+    if (memory == nullptr) {
+      memory = A::allocate(AbstractList<T, S, I>::template getEntrySize<Entry>());
+      if (memory == nullptr) {
+        return nullptr;
+      }
+    }
+    return AbstractList<T, S, I>::template constructEntry<Entry>(memory, value);
+  }
+
+  /*!
+   * @brief Delete an entry, created by createEntry(). Inline entries are given
+   *        back to the small buffer, all others to the allocator.
+   *
+   * @param entry   The entry to delete.
+   */
+  void deleteEntry(Entry *entry) {
+    void *memory = AbstractList<T, S, I>::destroyEntry(entry);
+    if (!this->releaseInlineEntry(memory)) {
+      A::deallocate(memory, AbstractList<T, S, I>::template getEntrySize<Entry>());
+    }
+  }
+
+ public:
+  /*!
+   * @brief Forward iterator over the entries of the list.
+   *
+   * @note  The iterator walks the entries directly, so a full traversal costs
+   *        O(n) instead of the O(n^2) of an index-based loop with get().
+   * @note  An iterator remembers the entry before its own one. Adding or
+   *        removing entries therefore invalidates iterators pointing to the
+   *        affected entries and to the entry behind them. Continue with the
+   *        iterator returned by insertBefore(), insertAfter() or erase().
+   */
+  class Iterator {
+    friend class SingleLinkedList<T, S, I, K, A>;
+
+    Entry *previous = nullptr;/// The entry before the current one, needed for
+                              /// insertions and deletions in O(1).
+    Entry *current = nullptr;/// The entry, the iterator points to.
+    SingleLinkedList<T, S, I, K, A> *list = nullptr;/// The iterated list.
+
+    /*!
+     * @brief Constructor of an Iterator Object.
+     *
+     * @param previousEntry   Entry before the one the iterator points to;
+     *                        nullptr if the iterator points to the head.
+     * @param entry   Entry the iterator points to; nullptr for the end.
+     * @param list    The iterated list.
+     */
+    Iterator(Entry *previousEntry, Entry *entry, SingleLinkedList<T, S, I, K, A> *list)
+        : previous(previousEntry), current(entry), list(list) {}
+
+   public:
+    /*!
+     * @brief Get the value of the entry, the iterator points to.
+     *
+     * @note  Must not be called on the end iterator.
+     *
+     * @return  Reference to the value.
+     */
+    T &operator*() const { return *current->getValue(list->isMutable()); }
+
+    /*!
+     * @brief Access the members of the value, the iterator points to.
+     *
+     * @note  Must not be called on the end iterator.
+     *
+     * @return  Pointer to the value.
+     */
+    T *operator->() const { return current->getValue(list->isMutable()); }
+
+    /*!
+     * @brief Move the iterator to the next entry (prefix).
+     *
+     * @return  Reference to this iterator.
+     */
+    Iterator &operator++() {
+      previous = current;
+      current = current->getNext();
+      return *this;
+    }
+
+    /*!
+     * @brief Move the iterator to the next entry (postfix).
+     *
+     * @return  Iterator pointing to the entry before the increment.
+     */
+    Iterator operator++(int) {
+      Iterator before = *this;
+      ++*this;
+      return before;
+    }
+
+    /*!
+     * @brief Compare two iterators whether they point to the same entry.
+     *
+     * @param other   Second iterator to compare.
+     * @return  true if both iterators point to the same entry; false otherwise.
+     */
+    bool operator==(const Iterator &other) const { return current == other.current; }
+
+    /*!
+     * @brief Opposite of '=='
+     *
+     * @param other   Second iterator to compare.
+     * @return  true if the iterators point to different entries; false
+     *          otherwise.
+     */
+    bool operator!=(const Iterator &other) const { return current != other.current; }
+  };
+
+ protected:
+  /*!
+   * @copydoc AbstractList::getPointer()
+   */
+  T *getPointer(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return nullptr;
+    }
+
+    return findEntry(index)->getValue(this->isMutable());
   }
 
  public:
+  /*!
+   * @brief Constructor of a SingleLinkedList Object. It is immutable, unless the
+   *        storage policy fixes it to be mutable.
+   */
+  SingleLinkedList() {}
+
   /*!
    * @brief Constructor of a SingleLinkedList Object.
    *
-   * @param mutableList true if the list should be mutable; false otherwise
-   *                    (default).
+   * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only lists with the storage policy Storage::Runtime take this
+   *        argument; with Storage::ByValue and Storage::ByReference, it does
+   *        not compile.
    */
-  explicit SingleLinkedList<T>(bool mutableList = false)
-      : AbstractList<T>(mutableList) {}
+  explicit SingleLinkedList(bool mutableList)
+      : AbstractList<T, S, I>(mutableList) {}
 
   /*!
    * @brief Destructor of a SingleLinkedList Object.
    */
-  ~SingleLinkedList() { this->clear(); }
+  ~SingleLinkedList() {
+    this->clear();
+    disableSkipIndex();
+  }
+
+  /*!
+   * @brief Get the allocator of the entries, e.g. to configure a stateful
+   *        allocator before adding the first value.
+   *
+   * @return    The allocator of this list.
+   */
+  A &getAllocator() { return *this; }
+
+  /*!
+   * @brief Preallocate the entries for the given number of values, so that
+   *        adding values up to this size does no allocator work.
+   *
+   * @note  Only allocators, that keep memory, like Allocator::Pool and
+   *        Allocator::Arena, can reserve entries. With the default
+   *        Allocator::Heap, nothing is reserved and false is returned, unless
+   *        the free inline entries already suffice.
+   *
+   * @param count   Number of values, the list should hold without
+   *                allocating.
+   * @return    true if adding values up to this size does no allocator work;
+   *            false if the allocator cannot reserve entries or the allocation
+   *            failed.
+   */
+  bool reserve(const I count) {
+    int size = static_cast<int>(this->getSize());
+    int missing = static_cast<int>(count) - size - (size < K ? K - size : 0);
+    if (missing <= 0) {
+      return true;
+    }
+    return Allocator::Traits<A>::reserve(*this, missing, AbstractList<T, S, I>::template getEntrySize<Entry>());
+  }
+
+  /*!
+   * @brief Enable an index, that samples every k-th entry of the list. Random
+   *        access then starts at the nearest sample, so that getPointer(),
+   *        addAtIndex() and remove() need O(n/k) instead of O(n) steps.
+   *
+   * @note  The index costs additional memory of about getSize() / stride
+   *        samples, each consisting of a pointer and an index. Small lists
+   *        should not use it.
+   * @note  Insertions and deletions by index keep the index up to date in
+   *        O(n/k). Insertions and deletions by iterator as well as clear()
+   *        drop the samples, which are then rebuilt on the next lookup.
+   *
+   * @param stride  Distance k between two sampled entries; must be at least 1.
+   */
+  void enableSkipIndex(const int stride) {
+    if (stride < 1) {
+      return;
+    }
+    if (skipIndex == nullptr) {
+      skipIndex = new (std::nothrow) SkipIndex();
+      if (skipIndex == nullptr) {
+        return;// the allocation failed, so the list stays without index
+      }
+    }
+    skipIndex->stride = stride;
+    skipIndex->count = 0;
+  }
+
+  /*!
+   * @brief Disable the index, enabled by enableSkipIndex(), and free its
+   *        memory.
+   */
+  void disableSkipIndex() {
+    delete skipIndex;
+    skipIndex = nullptr;
+  }
+
+  /*!
+   * @brief Get an iterator pointing to the first entry of the list.
+   *
+   * @return  Iterator to the first entry, or end() if the list is empty.
+   */
+  Iterator begin() { return Iterator(nullptr, head, this); }
+
+  /*!
+   * @brief Get an iterator pointing behind the last entry of the list.
+   *
+   * @return  Iterator marking the end of the list.
+   */
+  Iterator end() { return Iterator(tail, nullptr, this); }
 
-  using AbstractList<T>::addAtIndex;///'Using' the addAtIndex method, to
-                                    /// prevent name hiding of the addAtIndex
-                                    /// method from AbstractList
+  using AbstractList<T, S, I>::addAtIndex;///'Using' the addAtIndex method, to
+                                       /// prevent name hiding of the addAtIndex
+                                       /// method from AbstractList
 
   /*!
    * @copydoc AbstractList::addAtIndex()
    */
-  void addAtIndex(int index, T &value) override {
+  void addAtIndex(I index, T &value) override {
     // it is allowed, that index == this->getSize() to insert it behind the last
     // entry
-    if (extendedIsIndexOutOfBounds(index)) {
+    if (extendedIsIndexOutOfBounds(index) || this->isSizeLimitReached()) {
       return;
     }
 
-    Entry *entry;
+    if (index <= cursorIndex) {
+      resetCursor();
+    }
 
-    entry = new Entry();
-    entry->setValue(value, this->isMutable());
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return;// the allocation failed
+    }
 
     if (index == 0) {
       if (this->getSize() == 0) {
@@ -132,57 +559,234 @@ class SingleLinkedList : public AbstractList<T> {
       tail = entry;
     } else {
       // Add entry to not empty list, somewhere in the middle
-      Entry *current = head;
-      for (int i = 0; i < index - 1; ++i) {
-        current = current->getNext();
-      }
+      Entry *current = findEntry(index - 1);
       entry->setNext(current->getNext());
       current->setNext(entry);
     }
 
+    if (skipIndex != nullptr) {
+      skipIndex->inserted(index);
+    }
     this->increaseSize();
   };
 
   /*!
-   * @copydoc AbstractList::clear()
+   * @brief Add the value in front of the entry, the iterator points to.
+   *
+   * @note  Runs in O(1), because no search is necessary.
+   * @note  Inserting in front of end() adds the value at the end of the list.
+   * @note  The given iterator must not be used for further insertions or
+   *        deletions. Continue with the returned iterator instead.
+   * @note  Iterators pointing to the entry behind the new one become invalid.
+   * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
+   * @note  If the size limit of the index type is reached or the allocation
+   *        fails, nothing happen and the given iterator is returned.
+   *
+   * @param position    Iterator of this list, in front of which the value
+   *                    should be added.
+   * @param value   Value of the new entry.
+   * @return    Iterator pointing to the new entry.
    */
-  void clear() override {
-    if (this->getSize() == 0) {
-      return;
+  Iterator insertBefore(const Iterator &position, T &value) {
+    if (this->isSizeLimitReached()) {
+      return position;
+    }
+
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return position;// the allocation failed
+    }
+
+    entry->setNext(position.current);
+    if (position.previous == nullptr) {
+      head = entry;
+    } else {
+      position.previous->setNext(entry);
+    }
+    if (position.current == nullptr) {
+      tail = entry;
+    }
+
+    resetCursor();
+    invalidateSkipIndex();
+    this->increaseSize();
+    return Iterator(position.previous, entry, this);
+  }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @copydoc SingleLinkedList::insertBefore()
+   * @note If the list is mutable nothing happen and the given iterator is
+   * returned.
+   */
+  Iterator insertBefore(const Iterator &position, T &&value) {
+    if (this->isMutable()) {
+      return position;// Mutable lists cannot save rvalues!
+    }
+    return insertBefore(position, value);
+  }
+#endif
+
+  /*!
+   * @brief Add the value behind the entry, the iterator points to.
+   *
+   * @note  Runs in O(1), because no search is necessary.
+   * @note  The iterator must not be end().
+   * @note  Iterators pointing to the entry behind the new one become invalid.
+   * @note  If this list is mutable, ensure, that all variables added to the lists do not go out-of-scope during all operations of the list.
+   * @note  If the size limit of the index type is reached or the allocation
+   *        fails, nothing happen and the given iterator is returned.
+   *
+   * @param position    Iterator of this list, behind which the value should be
+   *                    added.
+   * @param value   Value of the new entry.
+   * @return    Iterator pointing to the new entry.
+   */
+  Iterator insertAfter(const Iterator &position, T &value) {
+    if (this->isSizeLimitReached()) {
+      return position;
+    }
+
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return position;// the allocation failed
+    }
+
+    entry->setNext(position.current->getNext());
+    position.current->setNext(entry);
+    if (position.current == tail) {
+      tail = entry;
+    }
+
+    resetCursor();
+    invalidateSkipIndex();
+    this->increaseSize();
+    return Iterator(position.current, entry, this);
+  }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @copydoc SingleLinkedList::insertAfter()
+   * @note If the list is mutable nothing happen and the given iterator is
+   * returned.
+   */
+  Iterator insertAfter(const Iterator &position, T &&value) {
+    if (this->isMutable()) {
+      return position;// Mutable lists cannot save rvalues!
+    }
+    return insertAfter(position, value);
+  }
+#endif
+
+  /*!
+   * @brief Remove the entry, the iterator points to.
+   *
+   * @note  Runs in O(1), because no search is necessary.
+   * @note  The iterator must not be end(). The given iterator, iterators
+   *        pointing to the removed entry and iterators pointing to the entry
+   *        behind it become invalid, because they remember the removed entry
+   *        as their predecessor. Continue with the returned iterator, which
+   *        points to the entry behind the removed one.
+   *
+   * @param position    Iterator of this list pointing to the entry to remove.
+   * @return    Iterator pointing to the entry behind the removed one.
+   */
+  Iterator erase(const Iterator &position) {
+    Entry *toDelete = position.current;
+    Entry *next = toDelete->getNext();
+
+    if (position.previous == nullptr) {
+      head = next;
+    } else {
+      position.previous->setNext(next);
+    }
+    if (toDelete == tail) {
+      tail = position.previous;
     }
 
+    this->deleteEntry(toDelete);
+
+    resetCursor();
+    invalidateSkipIndex();
+    this->decreaseSize();
+    return Iterator(position.previous, next, this);
+  }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @brief Call the given function for every value of the list, from the first
+   *        to the last entry.
+   *
+   * @note  The entries are walked directly and the function is inlined, so
+   *        neither a virtual call nor a copy of the value happens per entry.
+   * @note  The function must not add or remove entries of this list.
+   *
+   * @tparam F  Type of the function, callable with T&.
+   * @param function    Function, lambda or functor to call with a reference to
+   *                    each value.
+   */
+  template<typename F>
+  void forEach(F &&function) {
+    const bool mutableList = this->isMutable();
+    for (Entry *current = head; current != nullptr; current = current->getNext()) {
+      function(*current->getValue(mutableList));
+    }
+  }
+#endif
+
+  /*!
+   * @copydoc AbstractList::clear()
+   * @note  With a resettable allocator (like Allocator::Arena), the entries
+   *        are only visited, if the values have to be destroyed.
+   */
+  void clear() override {
     Entry *current = head;
     Entry *next;
-    for (int i = 0; i < this->getSize(); ++i) {
-      next = current->getNext();
+    if (Allocator::Traits<A>::resettable) {
+      // the allocator frees all entries at once, so only the values have to be
+      // destroyed. The reset is needed even for an empty list, because
+      // removed entries are not given back to a resettable allocator.
+      if (!this->isMutable() && !AbstractList<T, S, I>::isTriviallyDestructible()) {
+        for (I i = 0; i < this->getSize(); ++i) {
+          next = current->getNext();
+
+          AbstractList<T, S, I>::destroyEntry(current);
+          current = next;
+        }
+      }
+      this->resetInlineEntries();
+      Allocator::Traits<A>::reset(*this);
+    } else {
+      for (I i = 0; i < this->getSize(); ++i) {
+        next = current->getNext();
 
-      delete current;
-      current = next;
+        this->deleteEntry(current);
+        current = next;
+      }
     }
 
     this->resetSize();
     head = nullptr;
     tail = nullptr;
+    resetCursor();
+    invalidateSkipIndex();
   }
 
   /*!
    * @copydoc AbstractList::remove()
    */
-  void remove(int index) override {
+  void remove(I index) override {
     if (this->isIndexOutOfBounds(index)) {
       return;
     }
 
-    Entry *current = head;
+    if (index <= cursorIndex) {
+      resetCursor();
+    }
+
     // current is either the element to delete if index == 0, or the previous
     // element
-    if (index != 0) {
-      int i = 0;
-      while (i < index - 1) {
-        current = current->getNext();
-        i++;
-      }
-    }
+    Entry *current = index == 0 ? head : findEntry(index - 1);
 
     if (index == this->getSize() - 1) {
       tail = current;
@@ -197,8 +801,11 @@ class SingleLinkedList : public AbstractList<T> {
       current->setNext(current->getNext()->getNext());
     }
 
-    delete toDelete;
+    this->deleteEntry(toDelete);
 
+    if (skipIndex != nullptr) {
+      skipIndex->removed(index);
+    }
     this->decreaseSize();
 
     if (this->getSize() == 0) {
@@ -0,0 +1,225 @@
+/*!
+ * @file StaticList.hpp
+ *
+ * This file is part of the List library. It extends the arduino ecosystem with
+ * easy-to-use list implementations. They are specially designed and optimized
+ * for different purposes.
+ *
+ * Copyright (C) 2024  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef LIST_STATIC_LIST_HPP
+#define LIST_STATIC_LIST_HPP
+
+#include "AbstractList.hpp"
+
+/*!
+ * @brief   Implementation of a list with a fixed capacity of N values. The
+ *          values are stored in an array inside the list object, so the list
+ *          never allocates memory on the heap. Accessing an index is O(1),
+ *          adding and removing shifts the values behind the index.
+ *
+ * @note    Adding to a full list is ignored, just like adding at an invalid
+ *          index. Use isFull() to check, if there is space left.
+ *
+ * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam N    Maximal number of values in the list.
+ * @tparam S    Storage policy (see Storage).
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ */
+template<typename T, int N, typename S = Storage::Runtime, typename I = int>
+class StaticList : public AbstractList<T, S, I> {
+  static_assert(N >= 1, "StaticList needs a capacity of at least 1");
+  static_assert(static_cast<I>(N) == N, "The capacity of a StaticList must fit into the index type");
+
+  typedef typename AbstractList<T, S, I>::ValueSlot ValueSlot;
+  typedef typename AbstractList<T, S, I>::ReferenceSlot ReferenceSlot;
+
+  /*!
+   * @brief Inline array of slots. Immutable lists use the values, mutable
+   *        lists the references.
+   */
+  union SlotArray {
+    ValueSlot values[N];/// Slots of an immutable list.
+    ReferenceSlot references[N];/// Slots of a mutable list.
+
+    SlotArray() {}
+    ~SlotArray() {}
+  } slots;/// The slots, of which the first getSize() are used.
+
+  /*!
+   * @brief Get the array of slots.
+   *
+   * @tparam Slot   ValueSlot for immutable lists; ReferenceSlot for mutable
+   *                lists.
+   * @return    The array of slots.
+   */
+  template<typename Slot>
+  Slot *getSlots() {
+    return reinterpret_cast<Slot *>(&slots);
+  }
+
+  /*!
+   * @brief Add a value at the given index.
+   *
+   * @tparam Slot   Slot type of the array.
+   * @param index   Index in the range 0 to getSize().
+   * @param value   Value to add.
+   */
+  template<typename Slot>
+  void addAtIndexWithSlots(const I index, T &value) {
+    Slot *array = getSlots<Slot>();
+    AbstractList<T, S, I>::moveSlots(array + index + 1, array + index, this->getSize() - index);
+    AbstractList<T, S, I>::constructSlot(array[index], value);
+    this->increaseSize();
+  }
+
+  /*!
+   * @brief Remove the value at the given index.
+   *
+   * @tparam Slot   Slot type of the array.
+   * @param index   Index in the range 0 to getSize() - 1.
+   */
+  template<typename Slot>
+  void removeWithSlots(const I index) {
+    Slot *array = getSlots<Slot>();
+    AbstractList<T, S, I>::destroySlot(array[index]);
+    AbstractList<T, S, I>::moveSlots(array + index, array + index + 1, this->getSize() - index - 1);
+    this->decreaseSize();
+  }
+
+  /*!
+   * @brief Destroy all values.
+   *
+   * @tparam Slot   Slot type of the array.
+   */
+  template<typename Slot>
+  void clearWithSlots() {
+    Slot *array = getSlots<Slot>();
+    for (I i = 0; i < this->getSize(); ++i) {
+      AbstractList<T, S, I>::destroySlot(array[i]);
+    }
+  }
+
+ protected:
+  /*!
+   * @copydoc AbstractList::getPointer()
+   */
+  T *getPointer(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return nullptr;
+    }
+
+    if (this->isMutable()) {
+      return AbstractList<T, S, I>::getSlotValue(getSlots<ReferenceSlot>()[index]);
+    }
+    return AbstractList<T, S, I>::getSlotValue(getSlots<ValueSlot>()[index]);
+  }
+
+ public:
+  /*!
+   * @brief Constructor of a StaticList Object. It is immutable, unless the
+   *        storage policy fixes it to be mutable.
+   */
+  StaticList() {}
+
+  /*!
+   * @brief Constructor of a StaticList Object.
+   *
+   * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only lists with the storage policy Storage::Runtime take this
+   *        argument; with Storage::ByValue and Storage::ByReference, it does
+   *        not compile.
+   */
+  explicit StaticList(bool mutableList)
+      : AbstractList<T, S, I>(mutableList) {}
+
+  /*!
+   * @brief Destructor of a StaticList Object.
+   */
+  ~StaticList() { this->clear(); }
+
+  /*!
+   * @brief Get the maximal number of values, the list can hold.
+   *
+   * @return    The capacity N.
+   */
+  I getCapacity() const { return N; }
+
+  /*!
+   * @brief Check if the list is full, so further values are not added.
+   *
+   * @return    true if the list holds N values; false otherwise.
+   */
+  bool isFull() const { return this->getSize() >= N; }
+
+  using AbstractList<T, S, I>::addAtIndex;///'Using' the addAtIndex method, to
+                                          /// prevent name hiding of the
+                                          /// addAtIndex method from AbstractList
+
+  /*!
+   * @copydoc AbstractList::addAtIndex()
+   */
+  void addAtIndex(I index, T &value) override {
+    // it is allowed, that index == this->getSize() to insert it behind the last
+    // entry
+    if (extendedIsIndexOutOfBounds(index) || this->isSizeLimitReached() || isFull()) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      addAtIndexWithSlots<ReferenceSlot>(index, value);
+    } else {
+      addAtIndexWithSlots<ValueSlot>(index, value);
+    }
+  }
+
+  /*!
+   * @copydoc AbstractList::clear()
+   */
+  void clear() override {
+    if (this->getSize() == 0) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      clearWithSlots<ReferenceSlot>();
+    } else {
+      clearWithSlots<ValueSlot>();
+    }
+
+    this->resetSize();
+  }
+
+  /*!
+   * @copydoc AbstractList::remove()
+   */
+  void remove(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      removeWithSlots<ReferenceSlot>(index);
+    } else {
+      removeWithSlots<ValueSlot>(index);
+    }
+  }
+};
+
+#endif// LIST_STATIC_LIST_HPP
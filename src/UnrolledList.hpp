@@ -0,0 +1,456 @@
+/*!
+ * @file UnrolledList.hpp
+ *
+ * This file is part of the List library. It extends the arduino ecosystem with
+ * easy-to-use list implementations. They are specially designed and optimized
+ * for different purposes.
+ *
+ * Copyright (C) 2024  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef LIST_UNROLLED_LIST_HPP
+#define LIST_UNROLLED_LIST_HPP
+
+#include "AbstractList.hpp"
+
+/*!
+ * @brief   Implementation of an unrolled linked list. Every node stores up to N
+ *          values, so the link and the allocation overhead of a node is shared
+ *          by N values and searching needs about N times fewer steps than in a
+ *          SingleLinkedList.
+ *
+ * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam N    Maximal number of values per node (2 to 255).
+ * @tparam S    Storage policy (see Storage).
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ */
+template<typename T, int N, typename S = Storage::Runtime, typename I = int>
+class UnrolledList : public AbstractList<T, S, I> {
+  static_assert(N >= 2 && N <= 255, "UnrolledList supports 2 to 255 values per node");
+
+  typedef typename AbstractList<T, S, I>::ValueSlot ValueSlot;
+  typedef typename AbstractList<T, S, I>::ReferenceSlot ReferenceSlot;
+
+  /*!
+   * @brief Class representing the links of one node of the list.
+   */
+  class Node {
+    Node *next = nullptr;/// Pointer to the next node of the list.
+    unsigned char count = 0;/// Number of used slots of the node.
+
+   public:
+    /*!
+     * @brief   Get the next node of the list.
+     *
+     * @return  Pointer to the next node.
+     */
+    Node *getNext() const { return next; }
+
+    /*!
+     * @brief   Set the next node of the list.
+     *
+     * @param nextNode Pointer to the next node.
+     */
+    void setNext(Node *nextNode) { next = nextNode; }
+
+    /*!
+     * @brief   Get the number of used slots.
+     *
+     * @return  Number of values stored in the node.
+     */
+    int getCount() const { return count; }
+
+    /*!
+     * @brief   Set the number of used slots.
+     *
+     * @param newCount  Number of values stored in the node.
+     */
+    void setCount(const int newCount) { count = newCount; }
+  };
+
+  /*!
+   * @brief Class representing one node of the list together with its slots.
+   *
+   * @tparam Slot   ValueSlot for immutable lists; ReferenceSlot for mutable
+   *                lists.
+   */
+  template<typename Slot>
+  class Block : public Node {
+   public:
+    Slot slots[N];/// The slots, of which the first getCount() are used.
+  };
+
+  Node *head = nullptr;/// The first node of the list.
+  Node *tail = nullptr;/// The last node of the list.
+  Node *cursor = nullptr;/// The last node visited by findNode().
+  I cursorStart = 0;/// The index of the first value of the cursor node.
+
+  /*!
+   * @brief Get the slots of a node.
+   *
+   * @tparam Slot   Slot type of the node.
+   * @param node    The node.
+   * @return    Array of the N slots of the node.
+   */
+  template<typename Slot>
+  static Slot *getSlots(Node *node) { return static_cast<Block<Slot> *>(node)->slots; }
+
+  /*!
+   * @brief Create a new empty node, with slots matching the mutability of the
+   *        list.
+   *
+   * @return    The new node, which is not linked into the list yet, or
+   *            nullptr if the allocation failed.
+   */
+  Node *createNode() {
+    if (this->isMutable()) {
+      return new (std::nothrow) Block<ReferenceSlot>();
+    }
+    return new (std::nothrow) Block<ValueSlot>();
+  }
+
+  /*!
+   * @brief Delete a node, created by createNode(). The values of its used
+   *        slots must be destroyed or moved before.
+   *
+   * @param node    The node to delete.
+   */
+  void deleteNode(Node *node) {
+    if (this->isMutable()) {
+      delete static_cast<Block<ReferenceSlot> *>(node);
+    } else {
+      delete static_cast<Block<ValueSlot> *>(node);
+    }
+  }
+
+  /*!
+   * @brief Find the node holding the value at the given index. The search
+   *        starts at the tail or the last visited node, if possible.
+   *
+   * @note  The index must be in the range 0 to getSize() - 1.
+   *
+   * @param index   Index of the value.
+   * @param offset  Is set to the position of the value inside the found node.
+   * @return    The node holding the value.
+   */
+  Node *findNode(I index, int &offset) {
+    I tailStart = this->getSize() - tail->getCount();
+    if (index >= tailStart) {
+      offset = index - tailStart;
+      return tail;
+    }
+
+    Node *current = head;
+    I start = 0;
+    if (cursor != nullptr && cursorStart <= index) {
+      current = cursor;
+      start = cursorStart;
+    }
+    while (static_cast<int>(index - start) >= current->getCount()) {
+      start += current->getCount();
+      current = current->getNext();
+    }
+
+    cursor = current;
+    cursorStart = start;
+    offset = index - start;
+    return current;
+  }
+
+  /*!
+   * @brief Find the node in front of the given one.
+   *
+   * @param node    Node of this list.
+   * @return    The previous node, or nullptr if the given node is the head.
+   */
+  Node *findPrevNode(Node *node) {
+    if (node == head) {
+      return nullptr;
+    }
+    Node *current = head;
+    while (current->getNext() != node) {
+      current = current->getNext();
+    }
+    return current;
+  }
+
+  /*!
+   * @brief Insert a value into a node, that is not full.
+   *
+   * @tparam Slot   Slot type of the node.
+   * @param node    The node.
+   * @param offset  Position inside the node, at which the value is inserted.
+   * @param value   Value to insert.
+   */
+  template<typename Slot>
+  void insertIntoNode(Node *node, const int offset, T &value) {
+    Slot *slots = getSlots<Slot>(node);
+    AbstractList<T, S, I>::moveSlots(slots + offset + 1, slots + offset, node->getCount() - offset);
+    AbstractList<T, S, I>::constructSlot(slots[offset], value);
+    node->setCount(node->getCount() + 1);
+  }
+
+  /*!
+   * @brief Split a full node by moving its upper half into a new node behind
+   *        it.
+   *
+   * @tparam Slot   Slot type of the node.
+   * @param node    The full node.
+   * @return    The new node, or nullptr if the allocation failed, leaving the
+   *            node unchanged.
+   */
+  template<typename Slot>
+  Node *splitNode(Node *node) {
+    Node *upper = createNode();
+    if (upper == nullptr) {
+      return nullptr;
+    }
+    Slot *from = getSlots<Slot>(node);
+    Slot *to = getSlots<Slot>(upper);
+
+    int keep = node->getCount() / 2;
+    AbstractList<T, S, I>::moveSlots(to, from + keep, node->getCount() - keep);
+    upper->setCount(node->getCount() - keep);
+    node->setCount(keep);
+
+    upper->setNext(node->getNext());
+    node->setNext(upper);
+    if (tail == node) {
+      tail = upper;
+    }
+    return upper;
+  }
+
+  /*!
+   * @brief Add a value at the given index.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   * @param index   Index in the range 0 to getSize().
+   * @param value   Value to add.
+   */
+  template<typename Slot>
+  void addAtIndexWithSlots(const I index, T &value) {
+    if (head == nullptr) {
+      head = createNode();
+      if (head == nullptr) {
+        return;// the allocation failed
+      }
+      tail = head;
+    }
+
+    if (index == this->getSize()) {
+      if (tail->getCount() == N) {
+        // start a new node instead of splitting, so appending keeps the nodes
+        // completely filled
+        Node *node = createNode();
+        if (node == nullptr) {
+          return;// the allocation failed
+        }
+        tail->setNext(node);
+        tail = node;
+      }
+      insertIntoNode<Slot>(tail, tail->getCount(), value);
+    } else {
+      int offset;
+      Node *node = findNode(index, offset);
+      if (node->getCount() == N) {
+        Node *upper = splitNode<Slot>(node);
+        if (upper == nullptr) {
+          return;// the allocation failed
+        }
+        if (offset > node->getCount()) {
+          offset -= node->getCount();
+          node = upper;
+        }
+      }
+      insertIntoNode<Slot>(node, offset, value);
+      cursor = nullptr;
+    }
+
+    this->increaseSize();
+  }
+
+  /*!
+   * @brief Remove the value at the given index. Nodes, that become less than
+   *        half full, borrow from or are merged with their next node.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   * @param index   Index in the range 0 to getSize() - 1.
+   */
+  template<typename Slot>
+  void removeWithSlots(const I index) {
+    int offset;
+    Node *node = findNode(index, offset);
+    cursor = nullptr;
+
+    Slot *slots = getSlots<Slot>(node);
+    AbstractList<T, S, I>::destroySlot(slots[offset]);
+    AbstractList<T, S, I>::moveSlots(slots + offset, slots + offset + 1, node->getCount() - offset - 1);
+    node->setCount(node->getCount() - 1);
+    this->decreaseSize();
+
+    Node *next = node->getNext();
+    if (node->getCount() == 0) {
+      Node *prev = findPrevNode(node);
+      if (prev == nullptr) {
+        head = next;
+      } else {
+        prev->setNext(next);
+      }
+      if (tail == node) {
+        tail = prev;
+      }
+      deleteNode(node);
+    } else if (node->getCount() < N / 2 && next != nullptr) {
+      Slot *nextSlots = getSlots<Slot>(next);
+      if (node->getCount() + next->getCount() <= N) {
+        // merge the next node into this one
+        AbstractList<T, S, I>::moveSlots(slots + node->getCount(), nextSlots, next->getCount());
+        node->setCount(node->getCount() + next->getCount());
+        node->setNext(next->getNext());
+        if (tail == next) {
+          tail = node;
+        }
+        deleteNode(next);
+      } else {
+        // borrow the first value of the next node
+        AbstractList<T, S, I>::moveSlot(slots[node->getCount()], nextSlots[0]);
+        node->setCount(node->getCount() + 1);
+        AbstractList<T, S, I>::moveSlots(nextSlots, nextSlots + 1, next->getCount() - 1);
+        next->setCount(next->getCount() - 1);
+      }
+    }
+  }
+
+  /*!
+   * @brief Destroy all values and delete all nodes.
+   *
+   * @tparam Slot   Slot type of the nodes.
+   */
+  template<typename Slot>
+  void clearWithSlots() {
+    Node *current = head;
+    while (current != nullptr) {
+      Node *next = current->getNext();
+      Slot *slots = getSlots<Slot>(current);
+      for (int i = 0; i < current->getCount(); ++i) {
+        AbstractList<T, S, I>::destroySlot(slots[i]);
+      }
+      deleteNode(current);
+      current = next;
+    }
+  }
+
+ protected:
+  /*!
+   * @copydoc AbstractList::getPointer()
+   */
+  T *getPointer(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return nullptr;
+    }
+
+    int offset;
+    Node *node = findNode(index, offset);
+    if (this->isMutable()) {
+      return AbstractList<T, S, I>::getSlotValue(getSlots<ReferenceSlot>(node)[offset]);
+    }
+    return AbstractList<T, S, I>::getSlotValue(getSlots<ValueSlot>(node)[offset]);
+  }
+
+ public:
+  /*!
+   * @brief Constructor of an UnrolledList Object. It is immutable, unless the
+   *        storage policy fixes it to be mutable.
+   */
+  UnrolledList() {}
+
+  /*!
+   * @brief Constructor of an UnrolledList Object.
+   *
+   * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only lists with the storage policy Storage::Runtime take this
+   *        argument; with Storage::ByValue and Storage::ByReference, it does
+   *        not compile.
+   */
+  explicit UnrolledList(bool mutableList)
+      : AbstractList<T, S, I>(mutableList) {}
+
+  /*!
+   * @brief Destructor of an UnrolledList Object.
+   */
+  ~UnrolledList() { this->clear(); }
+
+  using AbstractList<T, S, I>::addAtIndex;///'Using' the addAtIndex method, to
+                                          /// prevent name hiding of the
+                                          /// addAtIndex method from AbstractList
+
+  /*!
+   * @copydoc AbstractList::addAtIndex()
+   */
+  void addAtIndex(I index, T &value) override {
+    // it is allowed, that index == this->getSize() to insert it behind the last
+    // entry
+    if (extendedIsIndexOutOfBounds(index) || this->isSizeLimitReached()) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      addAtIndexWithSlots<ReferenceSlot>(index, value);
+    } else {
+      addAtIndexWithSlots<ValueSlot>(index, value);
+    }
+  }
+
+  /*!
+   * @copydoc AbstractList::clear()
+   */
+  void clear() override {
+    if (this->getSize() == 0) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      clearWithSlots<ReferenceSlot>();
+    } else {
+      clearWithSlots<ValueSlot>();
+    }
+
+    this->resetSize();
+    head = nullptr;
+    tail = nullptr;
+    cursor = nullptr;
+  }
+
+  /*!
+   * @copydoc AbstractList::remove()
+   */
+  void remove(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return;
+    }
+
+    if (this->isMutable()) {
+      removeWithSlots<ReferenceSlot>(index);
+    } else {
+      removeWithSlots<ValueSlot>(index);
+    }
+  }
+};
+
+#endif// LIST_UNROLLED_LIST_HPP
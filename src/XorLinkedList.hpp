@@ -0,0 +1,457 @@
+/*!
+ * @file XorLinkedList.hpp
+ *
+ * This file is part of the List library. It extends the arduino ecosystem with
+ * easy-to-use list implementations. They are specially designed and optimized
+ * for different purposes.
+ *
+ * Copyright (C) 2024  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef LIST_XOR_LINKED_LIST_HPP
+#define LIST_XOR_LINKED_LIST_HPP
+
+#include <stdint.h>
+
+#include "AbstractList.hpp"
+
+/*!
+ * @brief   Implementation of a double-linked list, whose entries store the
+ *          XOR of the addresses of both neighbours in a single link. The list
+ *          can be walked in both directions, as long as two neighbouring
+ *          entries are known, so it saves one pointer per entry compared to
+ *          the DoubleLinkedList.
+ *
+ * @tparam T    Data Type of entries, that should be stored in the list.
+ * @tparam S    Storage policy (see Storage).
+ * @tparam I    Type of the size and of the indices (see AbstractList).
+ */
+template<typename T, typename S = Storage::Runtime, typename I = int>
+class XorLinkedList : public AbstractList<T, S, I> {
+  /*!
+   * @brief Class representing one entry of the list.
+   */
+  class Entry {
+    uintptr_t link = 0;/// XOR of the addresses of the previous and the next
+                       /// entry.
+
+   public:
+    /*!
+     * @brief   Get a pointer to the value (mutable or immutable).
+     *
+     * @note    The entry must be created by AbstractList::createEntry().
+     *
+     * @param m   Indicates, if the list is mutable or immutable.
+     *
+     * @return  Pointer to the value of the entry.
+     */
+    T *getValue(const bool m) { return AbstractList<T, S, I>::getEntryValue(this, m); }
+
+    /*!
+     * @brief   Get the neighbour on the other side of the given one.
+     *
+     * @param neighbour   One neighbour of this entry, or nullptr at the head or
+     *                    the tail.
+     * @return  Pointer to the other neighbour.
+     */
+    Entry *getOther(const Entry *neighbour) const {
+      return reinterpret_cast<Entry *>(link ^ reinterpret_cast<uintptr_t>(neighbour));
+    }
+
+    /*!
+     * @brief   Set both neighbours of the entry.
+     *
+     * @param prevEntry   Pointer to the previous entry.
+     * @param nextEntry   Pointer to the next entry.
+     */
+    void setNeighbours(const Entry *prevEntry, const Entry *nextEntry) {
+      link = reinterpret_cast<uintptr_t>(prevEntry) ^ reinterpret_cast<uintptr_t>(nextEntry);
+    }
+
+    /*!
+     * @brief   Replace one neighbour of the entry, keeping the other one.
+     *
+     * @param oldEntry    The neighbour to replace.
+     * @param newEntry    The new neighbour.
+     */
+    void replaceNeighbour(const Entry *oldEntry, const Entry *newEntry) {
+      link ^= reinterpret_cast<uintptr_t>(oldEntry) ^ reinterpret_cast<uintptr_t>(newEntry);
+    }
+  };
+
+  I cursorIndex = 0;/// The index of the last visited entry.
+  Entry *head = nullptr;/// The first entry of the list.
+  Entry *tail = nullptr;/// The last entry of the list.
+  Entry *cursor = nullptr;/// The last entry visited by getPointer().
+  Entry *cursorPrev = nullptr;/// The entry in front of the cursor, needed to
+                              /// walk on from the cursor.
+
+  /*!
+   * @brief Create a new entry holding the given value.
+   *
+   * @param value   Value of the new entry.
+   * @return    The new entry, which is not linked into the list yet, or
+   *            nullptr if the allocation failed.
+   */
+  Entry *createEntry(T &value) { return AbstractList<T, S, I>::template createEntry<Entry>(value); }
+
+  /*!
+   * @brief Link a new entry between two neighbouring entries.
+   *
+   * @param entry   The new entry.
+   * @param prev    The entry, that should be in front of the new one; nullptr
+   *                to insert at the head.
+   * @param next    The entry, that should be behind the new one; nullptr to
+   *                insert at the tail.
+   */
+  void linkBetween(Entry *entry, Entry *prev, Entry *next) {
+    entry->setNeighbours(prev, next);
+    if (prev == nullptr) {
+      head = entry;
+    } else {
+      prev->replaceNeighbour(next, entry);
+    }
+    if (next == nullptr) {
+      tail = entry;
+    } else {
+      next->replaceNeighbour(prev, entry);
+    }
+  }
+
+  /*!
+   * @brief Find the entry at the given index. The search starts at the nearest
+   *        finger, which is either the head, the tail or the last visited
+   *        entry. Afterwards, the found entry is the new last visited entry.
+   *
+   * @note  The index must be in the range 0 to getSize() - 1.
+   *
+   * @param index   Index of the entry to find.
+   * @param prev    Is set to the entry in front of the found one.
+   * @return    The entry at the given index.
+   */
+  Entry *findEntry(I index, Entry *&prev) {
+    Entry *current = head;
+    prev = nullptr;
+    I i = 0;
+    I distance = index;
+    if (this->getSize() - 1 - index < distance) {
+      current = tail;
+      prev = tail->getOther(nullptr);
+      i = this->getSize() - 1;
+      distance = i - index;
+    }
+    if (cursor != nullptr) {
+      I cursorDistance = index > cursorIndex ? index - cursorIndex : cursorIndex - index;
+      if (cursorDistance < distance) {
+        current = cursor;
+        prev = cursorPrev;
+        i = cursorIndex;
+      }
+    }
+
+    while (i < index) {
+      Entry *next = current->getOther(prev);
+      prev = current;
+      current = next;
+      i++;
+    }
+    while (i > index) {
+      Entry *prevPrev = prev->getOther(current);
+      current = prev;
+      prev = prevPrev;
+      i--;
+    }
+
+    cursor = current;
+    cursorPrev = prev;
+    cursorIndex = index;
+    return current;
+  }
+
+ public:
+  /*!
+   * @brief Iterator over the entries of the list. The same iterator walks
+   *        forwards from begin() and backwards from rbegin(), because an
+   *        entry does not know, which of its neighbours is the previous one.
+   *
+   * @note  The iterator walks the entries directly, so a full traversal costs
+   *        O(n) instead of the O(n^2) of an index-based loop with get().
+   * @note  Adding or removing entries invalidates all iterators.
+   */
+  class Iterator {
+    friend class XorLinkedList<T, S, I>;
+
+    Entry *previous = nullptr;/// The entry visited before the current one.
+    Entry *current = nullptr;/// The entry, the iterator points to.
+    XorLinkedList<T, S, I> *list = nullptr;/// The iterated list.
+
+    /*!
+     * @brief Constructor of an Iterator Object.
+     *
+     * @param previousEntry   Entry visited before the one the iterator points
+     *                        to; nullptr at the start.
+     * @param entry   Entry the iterator points to; nullptr for the end.
+     * @param list    The iterated list.
+     */
+    Iterator(Entry *previousEntry, Entry *entry, XorLinkedList<T, S, I> *list)
+        : previous(previousEntry), current(entry), list(list) {}
+
+   public:
+    /*!
+     * @brief Get the value of the entry, the iterator points to.
+     *
+     * @note  Must not be called on the end iterator.
+     *
+     * @return  Reference to the value.
+     */
+    T &operator*() const { return *current->getValue(list->isMutable()); }
+
+    /*!
+     * @brief Access the members of the value, the iterator points to.
+     *
+     * @note  Must not be called on the end iterator.
+     *
+     * @return  Pointer to the value.
+     */
+    T *operator->() const { return current->getValue(list->isMutable()); }
+
+    /*!
+     * @brief Move the iterator to the next entry in its direction (prefix).
+     *
+     * @return  Reference to this iterator.
+     */
+    Iterator &operator++() {
+      Entry *next = current->getOther(previous);
+      previous = current;
+      current = next;
+      return *this;
+    }
+
+    /*!
+     * @brief Move the iterator to the next entry in its direction (postfix).
+     *
+     * @return  Iterator pointing to the entry before the increment.
+     */
+    Iterator operator++(int) {
+      Iterator before = *this;
+      ++*this;
+      return before;
+    }
+
+    /*!
+     * @brief Compare two iterators whether they point to the same entry.
+     *
+     * @param other   Second iterator to compare.
+     * @return  true if both iterators point to the same entry; false otherwise.
+     */
+    bool operator==(const Iterator &other) const { return current == other.current; }
+
+    /*!
+     * @brief Opposite of '=='
+     *
+     * @param other   Second iterator to compare.
+     * @return  true if the iterators point to different entries; false
+     *          otherwise.
+     */
+    bool operator!=(const Iterator &other) const { return current != other.current; }
+  };
+
+  typedef Iterator ReverseIterator;/// Iterator walking from the tail to the head.
+
+ protected:
+  /*!
+   * @copydoc AbstractList::getPointer()
+   */
+  T *getPointer(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return nullptr;
+    }
+
+    Entry *prev;
+    return findEntry(index, prev)->getValue(this->isMutable());
+  }
+
+ public:
+  /*!
+   * @brief Constructor of a XorLinkedList Object. It is immutable, unless the
+   *        storage policy fixes it to be mutable.
+   */
+  XorLinkedList() {}
+
+  /*!
+   * @brief Constructor of a XorLinkedList Object.
+   *
+   * @param mutableList true if the list should be mutable; false otherwise.
+   * @note  Only lists with the storage policy Storage::Runtime take this
+   *        argument; with Storage::ByValue and Storage::ByReference, it does
+   *        not compile.
+   */
+  explicit XorLinkedList(bool mutableList)
+      : AbstractList<T, S, I>(mutableList) {}
+
+  /*!
+   * @brief Destructor of a XorLinkedList Object.
+   */
+  ~XorLinkedList() { this->clear(); }
+
+  /*!
+   * @brief Get an iterator pointing to the first entry of the list.
+   *
+   * @return    Iterator pointing to the head, or end() if the list is empty.
+   */
+  Iterator begin() { return Iterator(nullptr, head, this); }
+
+  /*!
+   * @brief Get an iterator pointing behind the last entry of the list.
+   *
+   * @return    Iterator, that must not be dereferenced.
+   */
+  Iterator end() { return Iterator(tail, nullptr, this); }
+
+  /*!
+   * @brief Get an iterator pointing to the last entry of the list, that walks
+   *        towards the head.
+   *
+   * @return    Iterator pointing to the tail, or rend() if the list is empty.
+   */
+  ReverseIterator rbegin() { return ReverseIterator(nullptr, tail, this); }
+
+  /*!
+   * @brief Get an iterator pointing in front of the first entry of the list.
+   *
+   * @return    Iterator, that must not be dereferenced.
+   */
+  ReverseIterator rend() { return ReverseIterator(head, nullptr, this); }
+
+  using AbstractList<T, S, I>::addAtIndex;///'Using' the addAtIndex method, to
+                                          /// prevent name hiding of the
+                                          /// addAtIndex method from AbstractList
+
+  /*!
+   * @copydoc AbstractList::addAtIndex()
+   * @note  Adding at the head or the tail runs in O(1).
+   */
+  void addAtIndex(I index, T &value) override {
+    // it is allowed, that index == this->getSize() to insert it behind the last
+    // entry
+    if (extendedIsIndexOutOfBounds(index) || this->isSizeLimitReached()) {
+      return;
+    }
+
+    Entry *prev;
+    Entry *next;
+    if (index == this->getSize()) {
+      prev = tail;
+      next = nullptr;
+    } else {
+      next = findEntry(index, prev);
+    }
+
+    Entry *entry = createEntry(value);
+    if (entry == nullptr) {
+      return;// the allocation failed
+    }
+    linkBetween(entry, prev, next);
+
+    // the new entry is at the given index now
+    cursor = entry;
+    cursorPrev = prev;
+    cursorIndex = index;
+    this->increaseSize();
+  }
+
+#if __cplusplus >= 201103L || defined(__GXX_EXPERIMENTAL_CXX0X__)
+  /*!
+   * @brief Call the given function for every value of the list, from the first
+   *        to the last entry.
+   *
+   * @note  The function must not add or remove entries of this list.
+   *
+   * @tparam F  Type of the function, callable with T&.
+   * @param function    Function, lambda or functor to call with a reference to
+   *                    each value.
+   */
+  template<typename F>
+  void forEach(F &&function) {
+    const bool mutableList = this->isMutable();
+    Entry *prev = nullptr;
+    for (Entry *current = head; current != nullptr;) {
+      function(*current->getValue(mutableList));
+      Entry *next = current->getOther(prev);
+      prev = current;
+      current = next;
+    }
+  }
+#endif
+
+  /*!
+   * @copydoc AbstractList::clear()
+   */
+  void clear() override {
+    Entry *prev = nullptr;
+    Entry *current = head;
+    while (current != nullptr) {
+      Entry *next = current->getOther(prev);
+      prev = current;
+      this->deleteEntry(current);
+      current = next;
+    }
+
+    this->resetSize();
+    head = nullptr;
+    tail = nullptr;
+    cursor = nullptr;
+    cursorPrev = nullptr;
+    cursorIndex = 0;
+  }
+
+  /*!
+   * @copydoc AbstractList::remove()
+   * @note  Removing the head or the tail runs in O(1).
+   */
+  void remove(I index) override {
+    if (this->isIndexOutOfBounds(index)) {
+      return;
+    }
+
+    Entry *prev;
+    Entry *toDelete = findEntry(index, prev);
+    Entry *next = toDelete->getOther(prev);
+
+    if (prev == nullptr) {
+      head = next;
+    } else {
+      prev->replaceNeighbour(toDelete, next);
+    }
+    if (next == nullptr) {
+      tail = prev;
+    } else {
+      next->replaceNeighbour(toDelete, prev);
+    }
+
+    this->deleteEntry(toDelete);
+
+    // the next entry moves to the index of the removed one
+    cursor = next;
+    cursorPrev = prev;
+    cursorIndex = next == nullptr ? 0 : index;
+    this->decreaseSize();
+  }
+};
+
+#endif// LIST_XOR_LINKED_LIST_HPP
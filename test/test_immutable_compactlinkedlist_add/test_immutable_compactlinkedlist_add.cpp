@@ -0,0 +1,239 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <CompactLinkedList.hpp>
+
+// ---------- void add(T &value) ---------- //
+
+void add_primitive(void) {
+  CompactLinkedList<int> list;
+
+  for (int i = 0; i < 50; ++i) {
+    list.add(i);
+    TEST_ASSERT_EQUAL_INT(i + 1, list.getSize());
+  }
+
+  for (int i = 0; i < 50; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+}
+
+void add_class(void) {
+  CompactLinkedList<String> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(String(i));
+  }
+
+  for (int i = 0; i < 10; ++i) {
+    TEST_ASSERT_EQUAL_STRING(String(i).c_str(), list.get(i).c_str());
+  }
+}
+
+void add_mutable_primitive(void) {
+  CompactLinkedList<int> list(true);
+
+  int values[5] = {0, 1, 2, 3, 4};
+  for (int i = 0; i < 5; ++i) {
+    list.add(values[i]);
+  }
+
+  for (int i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_PTR(&values[i], list.getMutableValue(i));
+  }
+}
+
+void add_growth_primitive(void) {
+  CompactLinkedList<int> list;
+
+  TEST_ASSERT_EQUAL_INT(0, list.getCapacity());
+
+  for (int i = 0; i < 33; ++i) {
+    list.add(i);
+    TEST_ASSERT_TRUE(list.getCapacity() >= list.getSize());
+    TEST_ASSERT_TRUE(list.getCapacity() <= 2 * list.getSize() + 4);
+  }
+
+  int capacity = list.getCapacity();
+  list.clear();
+
+  TEST_ASSERT_EQUAL_INT(capacity, list.getCapacity());
+}
+
+void add_reserve_primitive(void) {
+  CompactLinkedList<int> list;
+
+  list.add(0);
+  TEST_ASSERT_TRUE(list.reserve(20));
+
+  TEST_ASSERT_EQUAL_INT(20, list.getCapacity());
+
+  for (int i = 1; i < 20; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(20, list.getCapacity());
+  for (int i = 0; i < 20; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+
+  CompactLinkedList<int, uint8_t> limited;
+  TEST_ASSERT_FALSE(limited.reserve(1000));
+
+  TEST_ASSERT_EQUAL_INT(255, limited.getCapacity());
+}
+
+void add_reuses_nodes_primitive(void) {
+  CompactLinkedList<int> list;
+
+  for (int i = 0; i < 8; ++i) {
+    list.add(i);
+  }
+  int capacity = list.getCapacity();
+
+  for (int i = 8; i < 100; ++i) {
+    list.removeFirst();
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(capacity, list.getCapacity());
+  for (int i = 0; i < 8; ++i) {
+    TEST_ASSERT_EQUAL_INT(92 + i, list.get(i));
+  }
+}
+
+void add_link_limit_primitive(void) {
+  CompactLinkedList<int, uint8_t> list;
+
+  for (int i = 0; i < 300; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(255, list.getSize());
+  TEST_ASSERT_EQUAL_INT(255, list.getCapacity());
+  TEST_ASSERT_EQUAL_INT(254, list.back());
+
+  list.removeFirst();
+  list.add(300);
+
+  TEST_ASSERT_EQUAL_INT(255, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.front());
+  TEST_ASSERT_EQUAL_INT(300, list.back());
+}
+
+void add_index_limit_primitive(void) {
+  CompactLinkedList<int, uint16_t, Storage::Runtime, uint8_t> list;
+
+  for (int i = 0; i < 300; ++i) {
+    list.add(i);
+  }
+
+  uint8_t capacity = list.getCapacity();
+
+  TEST_ASSERT_EQUAL_INT(255, list.getSize());
+  TEST_ASSERT_EQUAL_INT(255, capacity);
+  TEST_ASSERT_EQUAL_INT(254, list.back());
+}
+
+// ---------- void addAtIndex(int index, T &value) ---------- //
+
+void addAtIndex_primitive(void) {
+  CompactLinkedList<int> list;
+  int expected[100];
+  int size = 0;
+
+  for (int i = 0; i < 60; ++i) {
+    int index = (i * 7) % (size + 1);
+    list.addAtIndex(index, i);
+    for (int j = size; j > index; --j) {
+      expected[j] = expected[j - 1];
+    }
+    expected[index] = i;
+    size++;
+  }
+
+  TEST_ASSERT_EQUAL_INT(size, list.getSize());
+  for (int i = 0; i < size; ++i) {
+    TEST_ASSERT_EQUAL_INT(expected[i], list.get(i));
+  }
+}
+
+void addAtIndex_class(void) {
+  CompactLinkedList<String> list;
+
+  list.addAtIndex(0, "3");
+  list.addAtIndex(0, "1");
+  list.addAtIndex(1, "2");
+  list.addAtIndex(3, "4");
+  list.addAtIndex(0, "0");
+  list.addAtIndex(10, "x");
+
+  TEST_ASSERT_EQUAL_INT(5, list.getSize());
+  for (int i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_STRING(String(i).c_str(), list.get(i).c_str());
+  }
+}
+
+// ---------- void addFirst(T &value) ---------- //
+
+void addFirst_primitive(void) {
+  CompactLinkedList<int> list;
+
+  for (int i = 0; i < 20; ++i) {
+    list.addFirst(i);
+  }
+
+  for (int i = 0; i < 20; ++i) {
+    TEST_ASSERT_EQUAL_INT(19 - i, list.get(i));
+  }
+}
+
+// ---------- void addAll(AbstractList<T> &list) ---------- //
+
+void addAll_primitive(void) {
+  CompactLinkedList<int> list;
+  CompactLinkedList<int> other;
+
+  for (int i = 0; i < 10; ++i) {
+    other.add(i);
+  }
+
+  list.add(-1);
+  list.addAll(other);
+
+  TEST_ASSERT_EQUAL_INT(11, list.getSize());
+  TEST_ASSERT_EQUAL_INT(-1, list.get(0));
+  for (int i = 0; i < 10; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i + 1));
+  }
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- void add(T &value) ---------- //
+  RUN_TEST(add_primitive);
+  RUN_TEST(add_class);
+  RUN_TEST(add_mutable_primitive);
+  RUN_TEST(add_growth_primitive);
+  RUN_TEST(add_reserve_primitive);
+  RUN_TEST(add_reuses_nodes_primitive);
+  RUN_TEST(add_link_limit_primitive);
+  RUN_TEST(add_index_limit_primitive);
+
+  // ---------- void addAtIndex(int index, T &value) ---------- //
+  RUN_TEST(addAtIndex_primitive);
+  RUN_TEST(addAtIndex_class);
+
+  // ---------- void addFirst(T &value) ---------- //
+  RUN_TEST(addFirst_primitive);
+
+  // ---------- void addAll(AbstractList<T> &list) ---------- //
+  RUN_TEST(addAll_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}
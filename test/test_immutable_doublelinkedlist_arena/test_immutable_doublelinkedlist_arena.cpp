@@ -0,0 +1,144 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+class Counted {
+ public:
+  static int alive;
+
+  int value;
+
+  explicit Counted(int value = 0) : value(value) { alive++; }
+  Counted(const Counted &other) : value(other.value) { alive++; }
+  ~Counted() { alive--; }
+
+  bool operator==(const Counted &other) const { return value == other.value; }
+};
+
+int Counted::alive = 0;
+
+// ---------- Primitive ---------- //
+
+void primitive_add_get(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 0, Allocator::Arena<64> > list;
+
+  for (int i = 0; i < 50; ++i) {
+    list.add(i);
+  }
+  list.remove(10);
+
+  TEST_ASSERT_EQUAL_INT(49, list.getSize());
+  TEST_ASSERT_EQUAL_INT(9, list.get(9));
+  TEST_ASSERT_EQUAL_INT(11, list.get(10));
+  TEST_ASSERT_EQUAL_INT(49, list.get(48));
+}
+
+void primitive_clear_reuses_blocks(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 0, Allocator::Arena<> > list;
+
+  list.add(1);
+  int *first = &list.at(0);
+  list.add(2);
+  list.clear();
+
+  TEST_ASSERT_EQUAL_INT(0, list.getSize());
+
+  list.add(3);
+
+  TEST_ASSERT_EQUAL_PTR(first, &list.at(0));
+  TEST_ASSERT_EQUAL_INT(3, list.get(0));
+}
+
+void primitive_clear_after_remove_reuses_blocks(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 0, Allocator::Arena<64> > list;
+
+  for (int i = 0; i < 20; ++i) {
+    list.add(i);
+  }
+  int *first = &list.at(0);
+  int *last = &list.at(19);
+
+  for (int round = 0; round < 3; ++round) {
+    while (!list.isEmpty()) {
+      list.removeFirst();
+    }
+    list.clear();
+
+    for (int i = 0; i < 20; ++i) {
+      list.add(i);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(first, &list.at(0));
+    TEST_ASSERT_EQUAL_PTR(last, &list.at(19));
+  }
+}
+
+void primitive_inline_and_arena(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 2, Allocator::Arena<> > list;
+
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 5; ++i) {
+      list.add(round * 10 + i);
+    }
+
+    TEST_ASSERT_EQUAL_INT(5, list.getSize());
+    TEST_ASSERT_EQUAL_INT(round * 10, list.get(0));
+    TEST_ASSERT_EQUAL_INT(round * 10 + 4, list.get(4));
+
+    list.clear();
+  }
+}
+
+void primitive_release(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 0, Allocator::Arena<> > list;
+
+  list.add(1);
+  list.clear();
+  list.getAllocator().release();
+  list.add(2);
+
+  TEST_ASSERT_EQUAL_INT(2, list.get(0));
+}
+
+// ---------- Class ---------- //
+
+void class_destructors_called(void) {
+  {
+    DoubleLinkedList<Counted, Storage::Runtime, int, 0, Allocator::Arena<> > list;
+
+    for (int i = 0; i < 5; ++i) {
+      list.add(Counted(i));
+    }
+
+    TEST_ASSERT_EQUAL_INT(5, Counted::alive);
+
+    list.clear();
+
+    TEST_ASSERT_EQUAL_INT(0, Counted::alive);
+
+    list.add(Counted(1));
+  }
+
+  TEST_ASSERT_EQUAL_INT(0, Counted::alive);
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Primitive ---------- //
+  RUN_TEST(primitive_add_get);
+  RUN_TEST(primitive_clear_reuses_blocks);
+  RUN_TEST(primitive_clear_after_remove_reuses_blocks);
+  RUN_TEST(primitive_inline_and_arena);
+  RUN_TEST(primitive_release);
+
+  // ---------- Class ---------- //
+  RUN_TEST(class_destructors_called);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,91 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+// ---------- void forEach(F &&function) ---------- //
+
+void forEach_empty(void) {
+  DoubleLinkedList<int> list;
+
+  int calls = 0;
+  list.forEach([&calls](int &) { calls++; });
+
+  TEST_ASSERT_EQUAL_INT(0, calls);
+}
+
+void forEach_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  int expected = 0;
+  list.forEach([&expected](int &value) {
+    TEST_ASSERT_EQUAL_INT(expected++, value);
+  });
+  TEST_ASSERT_EQUAL_INT(10, expected);
+}
+
+void forEach_modify_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  list.add(1);
+  list.add(2);
+
+  list.forEach([](int &value) { value *= 10; });
+
+  TEST_ASSERT_EQUAL_INT(10, list.get(0));
+  TEST_ASSERT_EQUAL_INT(20, list.get(1));
+}
+
+void forEach_mutable_primitive(void) {
+  DoubleLinkedList<int> list(true);
+
+  int a = 1;
+  int b = 2;
+  list.add(a);
+  list.add(b);
+
+  list.forEach([](int &value) { value += 1; });
+
+  TEST_ASSERT_EQUAL_INT(2, a);
+  TEST_ASSERT_EQUAL_INT(3, b);
+}
+
+struct Concatenate {
+  String result;
+
+  void operator()(String &value) { result += value; }
+};
+
+void forEach_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("1");
+  list.add("2");
+  list.add("3");
+
+  Concatenate concatenate;
+  list.forEach(concatenate);
+
+  TEST_ASSERT_EQUAL_STRING("123", concatenate.result.c_str());
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- void forEach(F &&function) ---------- //
+  RUN_TEST(forEach_empty);
+  RUN_TEST(forEach_primitive);
+  RUN_TEST(forEach_modify_primitive);
+  RUN_TEST(forEach_mutable_primitive);
+  RUN_TEST(forEach_class);
+
+  UNITY_END();
+}
+
+void loop() {
+}
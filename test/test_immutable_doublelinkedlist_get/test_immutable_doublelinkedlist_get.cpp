@@ -100,6 +100,180 @@ void get_operator_class(void) {
   TEST_ASSERT_EQUAL_INT(2, list.getSize());
 }
 
+// ---------- T &at(int index) ---------- //
+
+void at_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  list.add(1);
+  list.add(2);
+
+  TEST_ASSERT_EQUAL_INT(1, list.at(0));
+  TEST_ASSERT_EQUAL_INT(2, list.at(1));
+
+  list.at(1) = 3;
+
+  TEST_ASSERT_EQUAL_INT(3, list.get(1));
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+}
+
+void at_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("1");
+  list.add("2");
+
+  TEST_ASSERT_EQUAL_STRING("1", list.at(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("2", list.at(1).c_str());
+  TEST_ASSERT_EQUAL_PTR(&list.at(1), &list.at(1));
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+}
+
+void at_const_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  list.add(1);
+  list.add(2);
+
+  const DoubleLinkedList<int> &constList = list;
+
+  TEST_ASSERT_EQUAL_INT(1, constList.at(0));
+  TEST_ASSERT_EQUAL_INT(2, constList.at(1));
+  TEST_ASSERT_EQUAL_INT(1, constList.front());
+  TEST_ASSERT_EQUAL_INT(2, constList.back());
+}
+
+// ---------- T &front() / T &back() ---------- //
+
+void front_back_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  list.add(1);
+
+  TEST_ASSERT_EQUAL_INT(1, list.front());
+  TEST_ASSERT_EQUAL_INT(1, list.back());
+
+  list.add(2);
+  list.add(3);
+
+  TEST_ASSERT_EQUAL_INT(1, list.front());
+  TEST_ASSERT_EQUAL_INT(3, list.back());
+
+  list.front() = 10;
+  list.back() = 30;
+
+  TEST_ASSERT_EQUAL_INT(10, list.get(0));
+  TEST_ASSERT_EQUAL_INT(30, list.get(2));
+}
+
+void front_back_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("1");
+  list.add("2");
+
+  TEST_ASSERT_EQUAL_STRING("1", list.front().c_str());
+  TEST_ASSERT_EQUAL_STRING("2", list.back().c_str());
+}
+
+void front_back_mutable_primitive(void) {
+  DoubleLinkedList<int> list(true);
+
+  int a = 1;
+  int b = 2;
+  list.add(a);
+  list.add(b);
+
+  TEST_ASSERT_EQUAL_PTR(&a, &list.front());
+  TEST_ASSERT_EQUAL_PTR(&b, &list.back());
+}
+
+// ---------- size_t getMany(const int *indices, size_t n, T *out) ---------- //
+
+void getMany_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 20; ++i) {
+    list.add(i * 10);
+  }
+
+  int indices[] = {0, 3, 4, 12, 19};
+  int values[5];
+
+  TEST_ASSERT_EQUAL_INT(5, list.getMany(indices, 5, values));
+  for (int i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_INT(indices[i] * 10, values[i]);
+  }
+}
+
+void getMany_unsorted_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 20; ++i) {
+    list.add(i * 10);
+  }
+
+  int indices[] = {7, 2, 20, 19, -1, 0};
+  int values[6] = {-1, -1, -1, -1, -1, -1};
+
+  TEST_ASSERT_EQUAL_INT(4, list.getMany(indices, 6, values));
+  TEST_ASSERT_EQUAL_INT(70, values[0]);
+  TEST_ASSERT_EQUAL_INT(20, values[1]);
+  TEST_ASSERT_EQUAL_INT(-1, values[2]);
+  TEST_ASSERT_EQUAL_INT(190, values[3]);
+  TEST_ASSERT_EQUAL_INT(-1, values[4]);
+  TEST_ASSERT_EQUAL_INT(0, values[5]);
+}
+
+void getMany_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("0");
+  list.add("1");
+  list.add("2");
+
+  int indices[] = {0, 2};
+  String values[2];
+
+  TEST_ASSERT_EQUAL_INT(2, list.getMany(indices, 2, values));
+  TEST_ASSERT_EQUAL_STRING("0", values[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("2", values[1].c_str());
+}
+
+// ---------- size_t getMany(const int *indices, size_t n, T **out) ---------- //
+
+void getMany_pointer_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  int indices[] = {1, 5, 10};
+  int *values[3];
+
+  TEST_ASSERT_EQUAL_INT(2, list.getMany(indices, 3, values));
+  TEST_ASSERT_EQUAL_INT(1, *values[0]);
+  TEST_ASSERT_EQUAL_INT(5, *values[1]);
+  TEST_ASSERT_EQUAL_PTR(nullptr, values[2]);
+}
+
+void getMany_pointer_mutable_primitive(void) {
+  DoubleLinkedList<int> list(true);
+
+  int a = 1;
+  int b = 2;
+  list.add(a);
+  list.add(b);
+
+  int indices[] = {0, 1};
+  int *values[2];
+
+  TEST_ASSERT_EQUAL_INT(2, list.getMany(indices, 2, values));
+  TEST_ASSERT_EQUAL_PTR(&a, values[0]);
+  TEST_ASSERT_EQUAL_PTR(&b, values[1]);
+}
+
 void setup() {
   UNITY_BEGIN();
 
@@ -115,6 +289,25 @@ void setup() {
   RUN_TEST(get_operator_primitive);
   RUN_TEST(get_operator_class);
 
+  // ---------- T &at(int index) ---------- //
+  RUN_TEST(at_primitive);
+  RUN_TEST(at_class);
+  RUN_TEST(at_const_primitive);
+
+  // ---------- T &front() / T &back() ---------- //
+  RUN_TEST(front_back_primitive);
+  RUN_TEST(front_back_class);
+  RUN_TEST(front_back_mutable_primitive);
+
+  // ---------- size_t getMany(const int *indices, size_t n, T *out) ---------- //
+  RUN_TEST(getMany_primitive);
+  RUN_TEST(getMany_unsorted_primitive);
+  RUN_TEST(getMany_class);
+
+  // ---------- size_t getMany(const int *indices, size_t n, T **out) ---------- //
+  RUN_TEST(getMany_pointer_primitive);
+  RUN_TEST(getMany_pointer_mutable_primitive);
+
   UNITY_END();
 }
 
@@ -0,0 +1,124 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+// ---------- Handle addFirstWithHandle(T &value) / Handle addLastWithHandle(T &value) ---------- //
+
+void addWithHandle_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  DoubleLinkedList<int>::Handle second = list.addLastWithHandle(2);
+  DoubleLinkedList<int>::Handle first = list.addFirstWithHandle(1);
+  DoubleLinkedList<int>::Handle third = list.addLastWithHandle(3);
+
+  TEST_ASSERT_TRUE(first.isValid());
+  TEST_ASSERT_TRUE(second.isValid());
+  TEST_ASSERT_TRUE(third.isValid());
+  TEST_ASSERT_TRUE(first != second);
+  TEST_ASSERT_EQUAL_INT(3, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(first));
+  TEST_ASSERT_EQUAL_INT(2, list.get(second));
+  TEST_ASSERT_EQUAL_INT(3, list.get(third));
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(2, list.get(1));
+  TEST_ASSERT_EQUAL_INT(3, list.get(2));
+}
+
+void addWithHandle_class(void) {
+  DoubleLinkedList<String> list;
+
+  DoubleLinkedList<String>::Handle handle = list.addLastWithHandle("1");
+  list.addFirstWithHandle("0");
+
+  TEST_ASSERT_EQUAL_STRING("1", list.get(handle).c_str());
+
+  list.get(handle) = "2";
+
+  TEST_ASSERT_EQUAL_STRING("2", list.get(1).c_str());
+}
+
+void addWithHandle_mutable_primitive(void) {
+  DoubleLinkedList<int> list(true);
+
+  int a = 1;
+  DoubleLinkedList<int>::Handle handle = list.addLastWithHandle(a);
+
+  TEST_ASSERT_EQUAL_PTR(&a, &list.get(handle));
+  TEST_ASSERT_FALSE(list.addLastWithHandle(2).isValid());
+  TEST_ASSERT_EQUAL_INT(1, list.getSize());
+}
+
+void handle_default_invalid(void) {
+  DoubleLinkedList<int>::Handle handle;
+
+  TEST_ASSERT_FALSE(handle.isValid());
+}
+
+// ---------- void remove(Handle handle) ---------- //
+
+void remove_handle_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  DoubleLinkedList<int>::Handle handles[5];
+  for (int i = 0; i < 5; ++i) {
+    handles[i] = list.addLastWithHandle(i);
+  }
+
+  list.remove(handles[2]);
+
+  TEST_ASSERT_EQUAL_INT(4, list.getSize());
+  TEST_ASSERT_EQUAL_INT(3, list.get(2));
+
+  list.remove(handles[0]);
+  list.remove(handles[4]);
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(3, list.get(1));
+  TEST_ASSERT_EQUAL_INT(1, list.get(handles[1]));
+  TEST_ASSERT_EQUAL_INT(3, list.get(handles[3]));
+
+  list.remove(handles[1]);
+  list.remove(handles[3]);
+
+  TEST_ASSERT_TRUE(list.isEmpty());
+
+  list.add(5);
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(0));
+}
+
+void remove_handle_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("1");
+  DoubleLinkedList<String>::Handle handle = list.addLastWithHandle("2");
+  list.add("3");
+
+  list.remove(handle);
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_STRING("1", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("3", list.get(1).c_str());
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Handle addFirstWithHandle(T &value) / Handle addLastWithHandle(T &value) ---------- //
+  RUN_TEST(addWithHandle_primitive);
+  RUN_TEST(addWithHandle_class);
+  RUN_TEST(addWithHandle_mutable_primitive);
+  RUN_TEST(handle_default_invalid);
+
+  // ---------- void remove(Handle handle) ---------- //
+  RUN_TEST(remove_handle_primitive);
+  RUN_TEST(remove_handle_class);
+
+  UNITY_END();
+}
+
+void loop() {
+}
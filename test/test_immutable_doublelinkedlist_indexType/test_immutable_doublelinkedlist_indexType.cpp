@@ -0,0 +1,51 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+// ---------- uint8_t ---------- //
+
+void uint8_add_get_remove(void) {
+  DoubleLinkedList<int, Storage::Runtime, uint8_t> list;
+
+  for (int i = 0; i < 200; ++i) {
+    list.add(i);
+  }
+  list.remove(0);
+  list.addAtIndex(150, 1000);
+
+  TEST_ASSERT_EQUAL_INT(200, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(150, list.get(149));
+  TEST_ASSERT_EQUAL_INT(1000, list.get(150));
+  TEST_ASSERT_EQUAL_INT(199, list.get(199));
+  TEST_ASSERT_EQUAL_INT(100, list.get(99));
+}
+
+void uint8_size_limit(void) {
+  DoubleLinkedList<int, Storage::Runtime, uint8_t> list;
+
+  for (int i = 0; i < 255; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_FALSE(list.addLastWithHandle(1).isValid());
+  TEST_ASSERT_TRUE(list.insertBefore(list.begin(), 1) == list.begin());
+  TEST_ASSERT_EQUAL_INT(255, list.getSize());
+  TEST_ASSERT_EQUAL_INT(0, list.front());
+  TEST_ASSERT_EQUAL_INT(254, list.back());
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- uint8_t ---------- //
+  RUN_TEST(uint8_add_get_remove);
+  RUN_TEST(uint8_size_limit);
+
+  UNITY_END();
+}
+
+void loop() {
+}
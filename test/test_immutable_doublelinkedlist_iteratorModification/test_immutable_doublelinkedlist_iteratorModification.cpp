@@ -0,0 +1,185 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+// ---------- Iterator insertBefore(Iterator position, T &value) ---------- //
+
+void insertBefore_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  list.insertBefore(list.end(), 2);
+
+  TEST_ASSERT_EQUAL_INT(1, list.getSize());
+  TEST_ASSERT_EQUAL_INT(2, list.get(0));
+
+  DoubleLinkedList<int>::Iterator it = list.insertBefore(list.begin(), 1);
+
+  TEST_ASSERT_EQUAL_INT(1, *it);
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+
+  ++it;
+  it = list.insertBefore(it, 5);
+  TEST_ASSERT_EQUAL_INT(5, *it);
+
+  list.insertBefore(list.end(), 3);
+
+  TEST_ASSERT_EQUAL_INT(4, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(5, list.get(1));
+  TEST_ASSERT_EQUAL_INT(2, list.get(2));
+  TEST_ASSERT_EQUAL_INT(3, list.get(3));
+
+  list.addLast(4);
+  TEST_ASSERT_EQUAL_INT(4, list.get(4));
+}
+
+void insertBefore_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("2");
+  list.insertBefore(list.begin(), "1");
+  list.insertBefore(list.end(), "3");
+
+  TEST_ASSERT_EQUAL_INT(3, list.getSize());
+  TEST_ASSERT_EQUAL_STRING("1", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("2", list.get(1).c_str());
+  TEST_ASSERT_EQUAL_STRING("3", list.get(2).c_str());
+}
+
+// ---------- Iterator insertAfter(Iterator position, T &value) ---------- //
+
+void insertAfter_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  list.add(1);
+  list.add(3);
+
+  DoubleLinkedList<int>::Iterator it = list.insertAfter(list.begin(), 2);
+
+  TEST_ASSERT_EQUAL_INT(2, *it);
+
+  ++it;
+  it = list.insertAfter(it, 4);
+
+  TEST_ASSERT_EQUAL_INT(4, list.getSize());
+  for (int i = 0; i < list.getSize(); ++i) {
+    TEST_ASSERT_EQUAL_INT(i + 1, list.get(i));
+  }
+
+  list.addLast(5);
+  TEST_ASSERT_EQUAL_INT(5, list.get(4));
+}
+
+void insertAfter_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("1");
+  list.insertAfter(list.begin(), "2");
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_STRING("1", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("2", list.get(1).c_str());
+}
+
+void insert_mutable_primitive(void) {
+  DoubleLinkedList<int> list(true);
+
+  int a = 1;
+  int b = 2;
+  list.insertBefore(list.end(), a);
+  list.insertAfter(list.begin(), b);
+  list.insertBefore(list.begin(), 3);
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_PTR(&a, list.getMutableValue(0));
+  TEST_ASSERT_EQUAL_PTR(&b, list.getMutableValue(1));
+}
+
+// ---------- Iterator erase(Iterator position) ---------- //
+
+void erase_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  // remove every odd value
+  for (DoubleLinkedList<int>::Iterator it = list.begin(); it != list.end();) {
+    if (*it % 2 != 0) {
+      it = list.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_INT(5, list.getSize());
+  for (int i = 0; i < list.getSize(); ++i) {
+    TEST_ASSERT_EQUAL_INT(i * 2, list.get(i));
+  }
+
+  list.add(10);
+  TEST_ASSERT_EQUAL_INT(10, list.get(5));
+}
+
+void erase_all_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  list.add(1);
+  list.add(2);
+
+  DoubleLinkedList<int>::Iterator it = list.begin();
+  it = list.erase(it);
+  TEST_ASSERT_EQUAL_INT(2, *it);
+  it = list.erase(it);
+
+  TEST_ASSERT_TRUE(it == list.end());
+  TEST_ASSERT_TRUE(list.isEmpty());
+  TEST_ASSERT_TRUE(list.begin() == list.end());
+
+  list.add(3);
+  TEST_ASSERT_EQUAL_INT(3, list.get(0));
+  TEST_ASSERT_EQUAL_INT(1, list.getSize());
+}
+
+void erase_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("1");
+  list.add("2");
+  list.add("3");
+
+  DoubleLinkedList<String>::Iterator it = list.begin();
+  ++it;
+  it = list.erase(it);
+
+  TEST_ASSERT_EQUAL_STRING("3", it->c_str());
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_STRING("1", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("3", list.get(1).c_str());
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Iterator insertBefore(Iterator position, T &value) ---------- //
+  RUN_TEST(insertBefore_primitive);
+  RUN_TEST(insertBefore_class);
+
+  // ---------- Iterator insertAfter(Iterator position, T &value) ---------- //
+  RUN_TEST(insertAfter_primitive);
+  RUN_TEST(insertAfter_class);
+  RUN_TEST(insert_mutable_primitive);
+
+  // ---------- Iterator erase(Iterator position) ---------- //
+  RUN_TEST(erase_primitive);
+  RUN_TEST(erase_all_primitive);
+  RUN_TEST(erase_class);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,102 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+// ---------- Primitive ---------- //
+
+void primitive_entry_reused(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 0, Allocator::Pool> list;
+
+  list.add(1);
+  list.add(2);
+  int *removed = &list.at(0);
+  list.remove(0);
+  list.add(3);
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_PTR(removed, &list.at(1));
+  TEST_ASSERT_EQUAL_INT(2, list.get(0));
+  TEST_ASSERT_EQUAL_INT(3, list.get(1));
+}
+
+void primitive_queue_churn(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 0, Allocator::Pool> list;
+
+  for (int i = 0; i < 4; ++i) {
+    list.addLast(i);
+  }
+  for (int i = 4; i < 100; ++i) {
+    list.removeFirst();
+    list.addLast(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(4, list.getSize());
+  for (int i = 0; i < 4; ++i) {
+    TEST_ASSERT_EQUAL_INT(96 + i, list.get(i));
+  }
+}
+
+void primitive_clear_and_release(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 0, Allocator::Pool> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+  list.clear();
+  list.getAllocator().release();
+  for (int i = 0; i < 3; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(3, list.getSize());
+  TEST_ASSERT_EQUAL_INT(2, list.get(2));
+}
+
+void primitive_mutable(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 0, Allocator::Pool> list(true);
+  int a = 1;
+  int b = 2;
+
+  list.add(a);
+  list.removeFirst();
+  list.add(b);
+
+  TEST_ASSERT_EQUAL_PTR(&b, list.getMutableValue(0));
+}
+
+// ---------- String ---------- //
+
+void string_queue_churn(void) {
+  DoubleLinkedList<String, Storage::Runtime, int, 0, Allocator::Pool> list;
+
+  list.addLast("a");
+  list.addLast("b");
+  list.removeFirst();
+  list.addLast("c");
+  list.removeFirst();
+  list.addLast("d");
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_STRING("c", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("d", list.get(1).c_str());
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Primitive ---------- //
+  RUN_TEST(primitive_entry_reused);
+  RUN_TEST(primitive_queue_churn);
+  RUN_TEST(primitive_clear_and_release);
+  RUN_TEST(primitive_mutable);
+
+  // ---------- String ---------- //
+  RUN_TEST(string_queue_churn);
+
+  UNITY_END();
+}
+
+void loop() {
+}
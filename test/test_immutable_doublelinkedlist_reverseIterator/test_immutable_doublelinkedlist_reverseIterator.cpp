@@ -0,0 +1,124 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+// ---------- ReverseIterator rbegin() / ReverseIterator rend() ---------- //
+
+void rbegin_rend_empty(void) {
+  DoubleLinkedList<int> list;
+
+  TEST_ASSERT_TRUE(list.rbegin() == list.rend());
+}
+
+void rbegin_rend_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  int expected = 9;
+  for (DoubleLinkedList<int>::ReverseIterator it = list.rbegin(); it != list.rend(); ++it) {
+    TEST_ASSERT_EQUAL_INT(expected--, *it);
+  }
+  TEST_ASSERT_EQUAL_INT(-1, expected);
+}
+
+void rbegin_rend_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("1");
+  list.add("2");
+  list.add("3");
+
+  String concatenated;
+  for (DoubleLinkedList<String>::ReverseIterator it = list.rbegin(); it != list.rend(); it++) {
+    concatenated += *it;
+  }
+  TEST_ASSERT_EQUAL_STRING("321", concatenated.c_str());
+}
+
+void reverse_decrement_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  list.add(1);
+  list.add(2);
+
+  DoubleLinkedList<int>::ReverseIterator it = list.rend();
+  --it;
+  TEST_ASSERT_EQUAL_INT(1, *it);
+  it--;
+  TEST_ASSERT_EQUAL_INT(2, *it);
+  TEST_ASSERT_TRUE(it == list.rbegin());
+}
+
+// ---------- Iterator operator-- ---------- //
+
+void decrement_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  DoubleLinkedList<int>::Iterator it = list.end();
+  int expected = 9;
+  while (it != list.begin()) {
+    --it;
+    TEST_ASSERT_EQUAL_INT(expected--, *it);
+  }
+  TEST_ASSERT_EQUAL_INT(-1, expected);
+}
+
+void decrement_class(void) {
+  DoubleLinkedList<String> list;
+
+  list.add("1");
+  list.add("2");
+
+  DoubleLinkedList<String>::Iterator it = list.begin();
+  ++it;
+  TEST_ASSERT_EQUAL_STRING("2", it->c_str());
+  it--;
+  TEST_ASSERT_EQUAL_STRING("1", it->c_str());
+  TEST_ASSERT_TRUE(it == list.begin());
+}
+
+void reverse_mutable_primitive(void) {
+  DoubleLinkedList<int> list(true);
+
+  int a = 1;
+  int b = 2;
+  list.add(a);
+  list.add(b);
+
+  DoubleLinkedList<int>::ReverseIterator it = list.rbegin();
+  *it = 20;
+  ++it;
+  *it = 10;
+
+  TEST_ASSERT_EQUAL_INT(10, a);
+  TEST_ASSERT_EQUAL_INT(20, b);
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- ReverseIterator rbegin() / ReverseIterator rend() ---------- //
+  RUN_TEST(rbegin_rend_empty);
+  RUN_TEST(rbegin_rend_primitive);
+  RUN_TEST(rbegin_rend_class);
+  RUN_TEST(reverse_decrement_primitive);
+
+  // ---------- Iterator operator-- ---------- //
+  RUN_TEST(decrement_primitive);
+  RUN_TEST(decrement_class);
+  RUN_TEST(reverse_mutable_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,180 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+// ---------- sequential get(int index) ---------- //
+
+void get_forward_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 100; ++i) {
+    list.add(i);
+  }
+
+  for (int i = 0; i < list.getSize(); ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+}
+
+void get_backward_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 100; ++i) {
+    list.add(i);
+  }
+
+  for (int i = list.getSize() - 1; i >= 0; --i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+}
+
+void get_alternating_class(void) {
+  DoubleLinkedList<String> list;
+
+  for (int i = 0; i < 20; ++i) {
+    list.add(String(i));
+  }
+
+  TEST_ASSERT_EQUAL_STRING("10", list.get(10).c_str());
+  TEST_ASSERT_EQUAL_STRING("11", list.get(11).c_str());
+  TEST_ASSERT_EQUAL_STRING("9", list.get(9).c_str());
+  TEST_ASSERT_EQUAL_STRING("15", list.get(15).c_str());
+  TEST_ASSERT_EQUAL_STRING("0", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("19", list.get(19).c_str());
+}
+
+// ---------- get(int index) after modification ---------- //
+
+void get_after_addAtIndex_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(5));
+
+  list.addAtIndex(3, 100);
+
+  TEST_ASSERT_EQUAL_INT(4, list.get(5));
+  TEST_ASSERT_EQUAL_INT(5, list.get(6));
+
+  list.addFirst(200);
+
+  TEST_ASSERT_EQUAL_INT(4, list.get(6));
+  TEST_ASSERT_EQUAL_INT(200, list.get(0));
+
+  list.addLast(300);
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(7));
+  TEST_ASSERT_EQUAL_INT(300, list.get(12));
+}
+
+void get_after_remove_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(5));
+
+  list.remove(5);
+
+  TEST_ASSERT_EQUAL_INT(6, list.get(5));
+
+  list.remove(2);
+
+  TEST_ASSERT_EQUAL_INT(7, list.get(5));
+
+  list.remove(7);
+
+  TEST_ASSERT_EQUAL_INT(7, list.get(5));
+  TEST_ASSERT_EQUAL_INT(8, list.get(6));
+}
+
+void get_after_clear_primitive(void) {
+  DoubleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(5));
+
+  list.clear();
+  for (int i = 10; i < 20; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(15, list.get(5));
+  TEST_ASSERT_EQUAL_INT(16, list.get(6));
+}
+
+// ---------- local access ---------- //
+
+void local_access_primitive(void) {
+  DoubleLinkedList<int> list;
+  int expected[64];
+  int size = 0;
+
+  for (int i = 0; i < 40; ++i) {
+    list.add(i);
+    expected[size++] = i;
+  }
+
+  // repeatedly insert, read and remove around a region in the middle
+  for (int round = 0; round < 20; ++round) {
+    int index = 15 + (round * 7) % 10;
+
+    list.addAtIndex(index, 100 + round);
+    for (int i = size; i > index; --i) {
+      expected[i] = expected[i - 1];
+    }
+    expected[index] = 100 + round;
+    size++;
+
+    for (int i = index - 3; i < index + 3; ++i) {
+      TEST_ASSERT_EQUAL_INT(expected[i], list.get(i));
+    }
+
+    list.remove(index + 1);
+    for (int i = index + 1; i < size - 1; ++i) {
+      expected[i] = expected[i + 1];
+    }
+    size--;
+
+    for (int i = index + 3; i > index - 3; --i) {
+      TEST_ASSERT_EQUAL_INT(expected[i], list.get(i));
+    }
+  }
+
+  TEST_ASSERT_EQUAL_INT(size, list.getSize());
+  for (int i = 0; i < size; ++i) {
+    TEST_ASSERT_EQUAL_INT(expected[i], list.get(i));
+  }
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- sequential get(int index) ---------- //
+  RUN_TEST(get_forward_primitive);
+  RUN_TEST(get_backward_primitive);
+  RUN_TEST(get_alternating_class);
+
+  // ---------- get(int index) after modification ---------- //
+  RUN_TEST(get_after_addAtIndex_primitive);
+  RUN_TEST(get_after_remove_primitive);
+  RUN_TEST(get_after_clear_primitive);
+
+  // ---------- local access ---------- //
+  RUN_TEST(local_access_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,132 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+template<typename L>
+bool isInline(L &list, int index) {
+  uintptr_t address = reinterpret_cast<uintptr_t>(&list.at(index));
+  return address >= reinterpret_cast<uintptr_t>(&list) && address < reinterpret_cast<uintptr_t>(&list + 1);
+}
+
+// ---------- Primitive ---------- //
+
+void primitive_first_entries_inline(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 4> list;
+
+  for (int i = 0; i < 6; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(6, list.getSize());
+  for (int i = 0; i < 6; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+    TEST_ASSERT_EQUAL(i < 4, isInline(list, i));
+  }
+}
+
+void primitive_inline_reused(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 4> list;
+
+  for (int i = 0; i < 6; ++i) {
+    list.add(i);
+  }
+  list.remove(1);
+  list.addFirst(100);
+
+  TEST_ASSERT_EQUAL_INT(6, list.getSize());
+  TEST_ASSERT_EQUAL_INT(100, list.get(0));
+  TEST_ASSERT_TRUE(isInline(list, 0));
+
+  list.clear();
+  for (int i = 0; i < 4; ++i) {
+    list.add(i);
+    TEST_ASSERT_TRUE(isInline(list, i));
+  }
+}
+
+void primitive_mutable(void) {
+  DoubleLinkedList<int, Storage::Runtime, int, 2> list(true);
+  int values[3] = {1, 2, 3};
+
+  for (int i = 0; i < 3; ++i) {
+    list.add(values[i]);
+  }
+
+  TEST_ASSERT_EQUAL_PTR(&values[0], list.getMutableValue(0));
+  TEST_ASSERT_EQUAL_PTR(&values[2], list.getMutableValue(2));
+}
+
+void primitive_no_buffer_by_default(void) {
+  TEST_ASSERT_EQUAL_INT(sizeof(DoubleLinkedList<int>), sizeof(DoubleLinkedList<int, Storage::Runtime, int, 0>));
+  TEST_ASSERT_TRUE(sizeof(DoubleLinkedList<int, Storage::Runtime, int, 4>) > sizeof(DoubleLinkedList<int>));
+}
+
+// ---------- Storage policy ---------- //
+
+struct Big {
+  char bytes[64];
+};
+
+void byReference_slots_hold_pointers(void) {
+  // an inline entry holds two links and a pointer to the value; the buffer adds a
+  // free list pointer and padding
+  TEST_ASSERT_TRUE(sizeof(DoubleLinkedList<Big, Storage::ByReference, int, 4>)
+                   <= sizeof(DoubleLinkedList<Big, Storage::ByReference>) + 4 * (2 + 1) * sizeof(void *) + 2 * sizeof(void *));
+  TEST_ASSERT_TRUE(sizeof(DoubleLinkedList<Big, Storage::ByValue, int, 4>) >= sizeof(DoubleLinkedList<Big, Storage::ByValue>) + 4 * sizeof(Big));
+}
+
+void byReference_inline_entries(void) {
+  DoubleLinkedList<int, Storage::ByReference, int, 2> list;
+  int values[3] = {1, 2, 3};
+
+  for (int i = 0; i < 3; ++i) {
+    list.add(values[i]);
+  }
+
+  TEST_ASSERT_EQUAL_INT(3, list.getSize());
+  for (int i = 0; i < 3; ++i) {
+    TEST_ASSERT_EQUAL_PTR(&values[i], list.getMutableValue(i));
+  }
+}
+
+// ---------- String ---------- //
+
+void string_spill_to_heap(void) {
+  DoubleLinkedList<String, Storage::Runtime, int, 2> list;
+
+  list.add("a");
+  list.add("b");
+  list.add("c");
+  list.remove(0);
+  list.add("d");
+
+  TEST_ASSERT_EQUAL_INT(3, list.getSize());
+  TEST_ASSERT_EQUAL_STRING("b", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("c", list.get(1).c_str());
+  TEST_ASSERT_EQUAL_STRING("d", list.get(2).c_str());
+  TEST_ASSERT_TRUE(isInline(list, 2));
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Primitive ---------- //
+  RUN_TEST(primitive_first_entries_inline);
+  RUN_TEST(primitive_inline_reused);
+  RUN_TEST(primitive_mutable);
+  RUN_TEST(primitive_no_buffer_by_default);
+
+  // ---------- Storage policy ---------- //
+  RUN_TEST(byReference_slots_hold_pointers);
+  RUN_TEST(byReference_inline_entries);
+
+  // ---------- String ---------- //
+  RUN_TEST(string_spill_to_heap);
+
+  UNITY_END();
+}
+
+void loop() {
+}
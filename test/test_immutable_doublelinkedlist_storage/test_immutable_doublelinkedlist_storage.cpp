@@ -0,0 +1,139 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <DoubleLinkedList.hpp>
+
+// ---------- Storage::ByValue ---------- //
+
+void byValue_primitive(void) {
+  DoubleLinkedList<int, Storage::ByValue> list;
+
+  TEST_ASSERT_FALSE(list.isMutable());
+
+  int value = 1;
+  list.add(value);
+  list.add(2);
+  value = 3;
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(2, list.get(1));
+  TEST_ASSERT_EQUAL_PTR(nullptr, list.getMutableValue(0));
+}
+
+void byValue_class(void) {
+  DoubleLinkedList<String, Storage::ByValue> list;
+
+  list.add("1");
+  list.add("2");
+
+  TEST_ASSERT_EQUAL_STRING("1", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("2", list.get(1).c_str());
+
+  list.remove(0);
+
+  TEST_ASSERT_EQUAL_STRING("2", list.get(0).c_str());
+}
+
+void byValue_smaller_than_runtime(void) {
+  TEST_ASSERT_TRUE(sizeof(DoubleLinkedList<int, Storage::ByValue>) < sizeof(DoubleLinkedList<int>));
+}
+
+// ---------- Storage::ByReference ---------- //
+
+void byReference_primitive(void) {
+  DoubleLinkedList<int, Storage::ByReference> list;
+
+  TEST_ASSERT_TRUE(list.isMutable());
+
+  int a = 1;
+  int b = 2;
+  list.add(a);
+  list.add(b);
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_PTR(&a, list.getMutableValue(0));
+  TEST_ASSERT_EQUAL_PTR(&b, list.getMutableValue(1));
+
+  a = 10;
+
+  TEST_ASSERT_EQUAL_INT(10, list.get(0));
+}
+
+void byReference_class(void) {
+  DoubleLinkedList<String, Storage::ByReference> list;
+
+  String a = "1";
+  list.add(a);
+  a = "2";
+
+  TEST_ASSERT_EQUAL_STRING("2", list.get(0).c_str());
+}
+
+// ---------- mixed storage policies ---------- //
+
+void equals_mixed_primitive(void) {
+  DoubleLinkedList<int, Storage::ByValue> list;
+  DoubleLinkedList<int> runtimeList;
+
+  list.add(1);
+  runtimeList.add(1);
+
+  TEST_ASSERT_TRUE(list.equals(runtimeList));
+  TEST_ASSERT_TRUE(runtimeList == list);
+
+  DoubleLinkedList<int, Storage::ByReference> mutableList;
+  int value = 1;
+  mutableList.add(value);
+
+  TEST_ASSERT_FALSE(list == mutableList);
+}
+
+void addAll_mixed_primitive(void) {
+  DoubleLinkedList<int, Storage::ByValue> list;
+  DoubleLinkedList<int> runtimeList;
+
+  runtimeList.add(1);
+  runtimeList.add(2);
+  list.addAll(runtimeList);
+  list + runtimeList;
+
+  TEST_ASSERT_EQUAL_INT(4, list.getSize());
+  TEST_ASSERT_EQUAL_INT(2, list.get(3));
+}
+
+// ---------- Storage::Runtime ---------- //
+
+void runtime_constructor_argument(void) {
+  DoubleLinkedList<int> immutableList;
+  DoubleLinkedList<int> mutableList(true);
+
+  TEST_ASSERT_FALSE(immutableList.isMutable());
+  TEST_ASSERT_TRUE(mutableList.isMutable());
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Storage::ByValue ---------- //
+  RUN_TEST(byValue_primitive);
+  RUN_TEST(byValue_class);
+  RUN_TEST(byValue_smaller_than_runtime);
+
+  // ---------- Storage::ByReference ---------- //
+  RUN_TEST(byReference_primitive);
+  RUN_TEST(byReference_class);
+
+  // ---------- mixed storage policies ---------- //
+  RUN_TEST(equals_mixed_primitive);
+  RUN_TEST(addAll_mixed_primitive);
+
+  // ---------- Storage::Runtime ---------- //
+  RUN_TEST(runtime_constructor_argument);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,130 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <List.hpp>
+
+class CountingAllocator {
+ public:
+  int allocations = 0;
+  int deallocations = 0;
+  size_t bytes = 0;
+
+  void *allocate(const size_t size) {
+    allocations++;
+    bytes += size;
+    return ::operator new(size);
+  }
+
+  void deallocate(void *memory, const size_t size) {
+    deallocations++;
+    bytes -= size;
+    ::operator delete(memory);
+  }
+};
+
+class RegionAllocator {
+  alignas(void *) uint8_t region[256];
+  size_t used = 0;
+
+ public:
+  void *allocate(const size_t size) {
+    size_t aligned = (size + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+    void *memory = region + used;
+    used += aligned;
+    return memory;
+  }
+
+  void deallocate(void *, const size_t) {}
+
+  bool contains(const void *memory) const { return memory >= region && memory < region + sizeof(region); }
+};
+
+// ---------- Primitive ---------- //
+
+void primitive_allocator_used(void) {
+  List<int, Storage::Runtime, int, 0, CountingAllocator> list;
+
+  for (int i = 0; i < 5; ++i) {
+    list.add(i);
+  }
+  list.remove(2);
+
+  TEST_ASSERT_EQUAL_INT(5, list.getAllocator().allocations);
+  TEST_ASSERT_EQUAL_INT(1, list.getAllocator().deallocations);
+  TEST_ASSERT_EQUAL_INT(3, list.get(2));
+
+  list.clear();
+
+  TEST_ASSERT_EQUAL_INT(5, list.getAllocator().deallocations);
+  TEST_ASSERT_EQUAL_INT(0, list.getAllocator().bytes);
+}
+
+void primitive_allocator_after_inline(void) {
+  List<int, Storage::Runtime, int, 2, CountingAllocator> list;
+
+  for (int i = 0; i < 5; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(3, list.getAllocator().allocations);
+
+  list.clear();
+
+  TEST_ASSERT_EQUAL_INT(3, list.getAllocator().deallocations);
+}
+
+void primitive_region_allocator(void) {
+  List<int, Storage::Runtime, int, 0, RegionAllocator> list;
+
+  for (int i = 0; i < 5; ++i) {
+    list.add(i);
+  }
+
+  for (int i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+    TEST_ASSERT_TRUE(list.getAllocator().contains(&list.at(i)));
+  }
+}
+
+void primitive_mutable_allocator(void) {
+  List<int, Storage::Runtime, int, 0, CountingAllocator> list(true);
+  int value = 1;
+
+  list.add(value);
+
+  TEST_ASSERT_EQUAL_PTR(&value, list.getMutableValue(0));
+  TEST_ASSERT_TRUE(list.getAllocator().bytes > 0);
+}
+
+// ---------- String ---------- //
+
+void string_allocator_used(void) {
+  List<String, Storage::Runtime, int, 0, CountingAllocator> list;
+
+  list.add("a");
+  list.add("b");
+  list.remove(0);
+
+  TEST_ASSERT_EQUAL_STRING("b", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_INT(2, list.getAllocator().allocations);
+  TEST_ASSERT_EQUAL_INT(1, list.getAllocator().deallocations);
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Primitive ---------- //
+  RUN_TEST(primitive_allocator_used);
+  RUN_TEST(primitive_allocator_after_inline);
+  RUN_TEST(primitive_region_allocator);
+  RUN_TEST(primitive_mutable_allocator);
+
+  // ---------- String ---------- //
+  RUN_TEST(string_allocator_used);
+
+  UNITY_END();
+}
+
+void loop() {
+}
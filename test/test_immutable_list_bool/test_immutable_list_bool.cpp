@@ -0,0 +1,93 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <List.hpp>
+
+// ---------- List<bool> ---------- //
+
+void bool_add_get(void) {
+  List<bool> list;
+
+  for (int i = 0; i < 50; ++i) {
+    list.add(i % 3 == 0);
+  }
+
+  TEST_ASSERT_EQUAL_INT(50, list.getSize());
+  for (int i = 0; i < 50; ++i) {
+    TEST_ASSERT_EQUAL(i % 3 == 0, list.get(i));
+  }
+  TEST_ASSERT_FALSE(list.isMutable());
+}
+
+void bool_mutable(void) {
+  List<bool> list(true);
+
+  bool value = false;
+  list.add(value);
+
+  TEST_ASSERT_TRUE(list.isMutable());
+  TEST_ASSERT_EQUAL_PTR(&value, list.getMutableValue(0));
+
+  value = true;
+
+  TEST_ASSERT_TRUE(list.get(0));
+}
+
+void bool_at_references_entry(void) {
+  List<bool> list;
+
+  list.add(false);
+  list.add(true);
+
+  TEST_ASSERT_TRUE(&list.at(0) != &list.at(1));
+  TEST_ASSERT_FALSE(list.at(0));
+  TEST_ASSERT_TRUE(list.at(1));
+}
+
+void bool_iterator(void) {
+  List<bool> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i % 2 == 0);
+  }
+
+  int i = 0;
+  for (bool value : list) {
+    TEST_ASSERT_EQUAL(i % 2 == 0, value);
+    i++;
+  }
+  TEST_ASSERT_EQUAL_INT(10, i);
+}
+
+void bool_equals_linked_list(void) {
+  List<bool> list;
+  SingleLinkedList<bool> other;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i % 2 == 0);
+    other.add(i % 2 == 0);
+  }
+
+  TEST_ASSERT_TRUE(list == other);
+
+  other.remove(0);
+
+  TEST_ASSERT_FALSE(list == other);
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- List<bool> ---------- //
+  RUN_TEST(bool_add_get);
+  RUN_TEST(bool_mutable);
+  RUN_TEST(bool_at_references_entry);
+  RUN_TEST(bool_iterator);
+  RUN_TEST(bool_equals_linked_list);
+
+  UNITY_END();
+}
+
+void loop() {
+}
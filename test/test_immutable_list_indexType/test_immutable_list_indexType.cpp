@@ -0,0 +1,88 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <List.hpp>
+
+// ---------- uint8_t ---------- //
+
+void uint8_add_get_remove(void) {
+  List<int, Storage::Runtime, uint8_t> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+  list.remove(0);
+  list.addAtIndex(4, 100);
+
+  TEST_ASSERT_EQUAL_INT(10, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(100, list.get(4));
+  TEST_ASSERT_EQUAL_INT(5, list.get(5));
+  TEST_ASSERT_EQUAL_INT(9, list.get(9));
+}
+
+void uint8_out_of_bounds(void) {
+  List<int, Storage::Runtime, uint8_t> list;
+
+  list.add(1);
+  list.remove(-1);
+  list.addAtIndex(-1, 2);
+
+  TEST_ASSERT_EQUAL_INT(1, list.getSize());
+  TEST_ASSERT_EQUAL_PTR(nullptr, list.getMutableValue(-1));
+}
+
+void uint8_size_limit(void) {
+  List<int, Storage::Runtime, uint8_t> list;
+
+  for (int i = 0; i < 300; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(255, list.getSize());
+  TEST_ASSERT_EQUAL_INT(254, list.get(254));
+
+  list.removeLast();
+  list.add(1000);
+
+  TEST_ASSERT_EQUAL_INT(255, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1000, list.get(254));
+}
+
+void uint8_smaller_than_int(void) {
+  TEST_ASSERT_TRUE(sizeof(List<int, Storage::ByValue, uint8_t>) <= sizeof(List<int, Storage::ByValue>));
+}
+
+void uint8_equals_int(void) {
+  List<int, Storage::Runtime, uint8_t> list;
+  List<int> other;
+
+  for (int i = 0; i < 5; ++i) {
+    list.add(i);
+    other.add(i);
+  }
+
+  TEST_ASSERT_TRUE(list == other);
+
+  list.addAll(other);
+
+  TEST_ASSERT_EQUAL_INT(10, list.getSize());
+  TEST_ASSERT_EQUAL_INT(4, list.get(9));
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- uint8_t ---------- //
+  RUN_TEST(uint8_add_get_remove);
+  RUN_TEST(uint8_out_of_bounds);
+  RUN_TEST(uint8_size_limit);
+  RUN_TEST(uint8_smaller_than_int);
+  RUN_TEST(uint8_equals_int);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,125 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <List.hpp>
+
+// ---------- Iterator begin() / Iterator end() ---------- //
+
+void begin_end_empty(void) {
+  List<int> list;
+
+  TEST_ASSERT_TRUE(list.begin() == list.end());
+  TEST_ASSERT_FALSE(list.begin() != list.end());
+}
+
+void begin_end_primitive(void) {
+  List<int> list;
+
+  list.add(1);
+  list.add(2);
+  list.add(3);
+
+  List<int>::Iterator it = list.begin();
+  TEST_ASSERT_EQUAL_INT(1, *it);
+  ++it;
+  TEST_ASSERT_EQUAL_INT(2, *it);
+  it++;
+  TEST_ASSERT_EQUAL_INT(3, *it);
+  ++it;
+  TEST_ASSERT_TRUE(it == list.end());
+}
+
+void begin_end_class(void) {
+  List<String> list;
+
+  list.add("1");
+  list.add("2");
+
+  List<String>::Iterator it = list.begin();
+  TEST_ASSERT_EQUAL_STRING("1", it->c_str());
+  ++it;
+  TEST_ASSERT_EQUAL_STRING("2", it->c_str());
+  ++it;
+  TEST_ASSERT_TRUE(it == list.end());
+}
+
+// ---------- range-based for ---------- //
+
+void range_for_primitive(void) {
+  List<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  int expected = 0;
+  for (int &value : list) {
+    TEST_ASSERT_EQUAL_INT(expected++, value);
+  }
+  TEST_ASSERT_EQUAL_INT(10, expected);
+}
+
+void range_for_class(void) {
+  List<String> list;
+
+  list.add("1");
+  list.add("2");
+  list.add("3");
+
+  String concatenated;
+  for (String &value : list) {
+    concatenated += value;
+  }
+  TEST_ASSERT_EQUAL_STRING("123", concatenated.c_str());
+}
+
+void range_for_modify_primitive(void) {
+  List<int> list;
+
+  list.add(1);
+  list.add(2);
+
+  for (int &value : list) {
+    value *= 10;
+  }
+
+  TEST_ASSERT_EQUAL_INT(10, list.get(0));
+  TEST_ASSERT_EQUAL_INT(20, list.get(1));
+}
+
+void range_for_mutable_primitive(void) {
+  List<int> list(true);
+
+  int a = 1;
+  int b = 2;
+  list.add(a);
+  list.add(b);
+
+  for (int &value : list) {
+    value += 1;
+  }
+
+  TEST_ASSERT_EQUAL_INT(2, a);
+  TEST_ASSERT_EQUAL_INT(3, b);
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Iterator begin() / Iterator end() ---------- //
+  RUN_TEST(begin_end_empty);
+  RUN_TEST(begin_end_primitive);
+  RUN_TEST(begin_end_class);
+
+  // ---------- range-based for ---------- //
+  RUN_TEST(range_for_primitive);
+  RUN_TEST(range_for_class);
+  RUN_TEST(range_for_modify_primitive);
+  RUN_TEST(range_for_mutable_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,173 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <List.hpp>
+
+class RecordingAllocator : public Allocator::Heap {
+ public:
+  size_t reserved = 0;
+
+  bool reserve(const size_t count, const size_t) {
+    reserved += count;
+    return true;
+  }
+};
+
+class PlainAllocator {
+ public:
+  void *allocate(const size_t size) { return malloc(size); }
+
+  void deallocate(void *memory, const size_t) { free(memory); }
+};
+
+template<typename L>
+bool isContiguous(L &list) {
+  ptrdiff_t stride = reinterpret_cast<char *>(&list.at(1)) - reinterpret_cast<char *>(&list.at(0));
+  for (int i = 1; i < list.getSize(); ++i) {
+    if (reinterpret_cast<char *>(&list.at(i)) - reinterpret_cast<char *>(&list.at(i - 1)) != stride) {
+      return false;
+    }
+  }
+  return stride > 0;
+}
+
+// ---------- Primitive ---------- //
+
+void primitive_reserve_missing_entries(void) {
+  List<int, Storage::Runtime, int, 0, RecordingAllocator> list;
+
+  list.add(1);
+
+  TEST_ASSERT_TRUE(list.reserve(10));
+  TEST_ASSERT_EQUAL_INT(9, list.getAllocator().reserved);
+
+  TEST_ASSERT_TRUE(list.reserve(1));
+
+  TEST_ASSERT_EQUAL_INT(9, list.getAllocator().reserved);
+}
+
+void primitive_reserve_without_inline_entries(void) {
+  List<int, Storage::Runtime, int, 4, RecordingAllocator> list;
+
+  list.add(1);
+
+  TEST_ASSERT_TRUE(list.reserve(10));
+  TEST_ASSERT_EQUAL_INT(6, list.getAllocator().reserved);
+
+  TEST_ASSERT_TRUE(list.reserve(4));
+
+  TEST_ASSERT_EQUAL_INT(6, list.getAllocator().reserved);
+}
+
+void primitive_reserve_heap(void) {
+  List<int> list;
+
+  TEST_ASSERT_TRUE(list.reserve(0));
+  TEST_ASSERT_FALSE(list.reserve(10));
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(10, list.getSize());
+  TEST_ASSERT_TRUE(list.reserve(10));
+}
+
+void primitive_reserve_heap_inline_entries(void) {
+  List<int, Storage::Runtime, int, 4> list;
+
+  list.add(1);
+
+  TEST_ASSERT_TRUE(list.reserve(4));
+  TEST_ASSERT_FALSE(list.reserve(5));
+}
+
+void primitive_reserve_without_allocator_reserve(void) {
+  List<int, Storage::Runtime, int, 0, PlainAllocator> list;
+
+  TEST_ASSERT_FALSE(list.reserve(10));
+
+  list.add(1);
+
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+}
+
+void primitive_reserve_pool(void) {
+  List<int, Storage::Runtime, int, 0, Allocator::Pool> list;
+
+  TEST_ASSERT_TRUE(list.reserve(50));
+  for (int i = 0; i < 50; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_TRUE(isContiguous(list));
+  TEST_ASSERT_EQUAL_INT(49, list.get(49));
+
+  list.clear();
+  list.getAllocator().release();
+  TEST_ASSERT_TRUE(list.reserve(50));
+  for (int i = 0; i < 60; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(60, list.getSize());
+  TEST_ASSERT_EQUAL_INT(59, list.get(59));
+}
+
+void primitive_reserve_arena(void) {
+  List<int, Storage::Runtime, int, 0, Allocator::Arena<16> > list;
+
+  TEST_ASSERT_TRUE(list.reserve(50));
+  for (int i = 0; i < 50; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_TRUE(isContiguous(list));
+  TEST_ASSERT_EQUAL_INT(49, list.get(49));
+
+  list.clear();
+  TEST_ASSERT_TRUE(list.reserve(50));
+  for (int i = 0; i < 50; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_TRUE(isContiguous(list));
+  TEST_ASSERT_EQUAL_INT(49, list.get(49));
+}
+
+// ---------- String ---------- //
+
+void string_reserve_pool(void) {
+  List<String, Storage::Runtime, int, 0, Allocator::Pool> list;
+
+  TEST_ASSERT_TRUE(list.reserve(3));
+  list.add("a");
+  list.add("b");
+  list.add("c");
+  list.add("d");
+
+  TEST_ASSERT_EQUAL_INT(4, list.getSize());
+  TEST_ASSERT_EQUAL_STRING("d", list.get(3).c_str());
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Primitive ---------- //
+  RUN_TEST(primitive_reserve_missing_entries);
+  RUN_TEST(primitive_reserve_without_inline_entries);
+  RUN_TEST(primitive_reserve_heap);
+  RUN_TEST(primitive_reserve_heap_inline_entries);
+  RUN_TEST(primitive_reserve_without_allocator_reserve);
+  RUN_TEST(primitive_reserve_pool);
+  RUN_TEST(primitive_reserve_arena);
+
+  // ---------- String ---------- //
+  RUN_TEST(string_reserve_pool);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,139 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <List.hpp>
+
+class LimitedAllocator : public Allocator::Heap {
+ public:
+  int remaining = 0;
+
+  void *allocate(const size_t size) {
+    if (remaining == 0) {
+      return nullptr;
+    }
+    remaining--;
+    return Allocator::Heap::allocate(size);
+  }
+};
+
+// ---------- Primitive ---------- //
+
+void primitive_tryAdd(void) {
+  List<int> list;
+
+  TEST_ASSERT_TRUE(list.tryAdd(1));
+  TEST_ASSERT_TRUE(list.tryAddAtIndex(0, 0));
+  TEST_ASSERT_TRUE(list.tryAddAtIndex(2, 2));
+  TEST_ASSERT_FALSE(list.tryAddAtIndex(4, 4));
+  TEST_ASSERT_FALSE(list.tryAddAtIndex(-1, 4));
+
+  TEST_ASSERT_EQUAL_INT(3, list.getSize());
+  for (int i = 0; i < 3; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+}
+
+void primitive_tryAdd_size_limit(void) {
+  List<int, Storage::Runtime, uint8_t> list;
+
+  for (int i = 0; i < 255; ++i) {
+    TEST_ASSERT_TRUE(list.tryAdd(i));
+  }
+
+  TEST_ASSERT_FALSE(list.tryAdd(255));
+  TEST_ASSERT_EQUAL_INT(255, list.getSize());
+}
+
+void primitive_tryAdd_allocation_failure(void) {
+  List<int, Storage::Runtime, int, 0, LimitedAllocator> list;
+
+  list.getAllocator().remaining = 2;
+
+  TEST_ASSERT_TRUE(list.tryAdd(1));
+  TEST_ASSERT_TRUE(list.tryAdd(2));
+  TEST_ASSERT_FALSE(list.tryAdd(3));
+  TEST_ASSERT_FALSE(list.tryAddAtIndex(0, 0));
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(2, list.get(1));
+
+  list.removeFirst();
+
+  TEST_ASSERT_FALSE(list.tryAdd(3));
+
+  list.getAllocator().remaining = 1;
+
+  TEST_ASSERT_TRUE(list.tryAddAtIndex(0, 1));
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(2, list.get(1));
+}
+
+void primitive_add_allocation_failure(void) {
+  List<int, Storage::Runtime, int, 2, LimitedAllocator> list;
+
+  for (int i = 0; i < 5; ++i) {
+    list.add(i);
+  }
+  list.addAtIndex(1, 10);
+  list.addFirst(20);
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_INT(0, list.get(0));
+  TEST_ASSERT_EQUAL_INT(1, list.get(1));
+}
+
+void primitive_insert_allocation_failure(void) {
+  List<int, Storage::Runtime, int, 0, LimitedAllocator> list;
+
+  list.getAllocator().remaining = 1;
+  List<int, Storage::Runtime, int, 0, LimitedAllocator>::Iterator it = list.insertBefore(list.end(), 1);
+  List<int, Storage::Runtime, int, 0, LimitedAllocator>::Iterator failed = list.insertAfter(it, 2);
+
+  TEST_ASSERT_TRUE(failed == it);
+  TEST_ASSERT_EQUAL_INT(1, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+}
+
+void primitive_mutable_tryAdd(void) {
+  List<int> list(true);
+  int value = 1;
+
+  TEST_ASSERT_TRUE(list.tryAdd(value));
+  TEST_ASSERT_FALSE(list.tryAdd(2));
+  TEST_ASSERT_EQUAL_INT(1, list.getSize());
+}
+
+// ---------- String ---------- //
+
+void string_tryAdd_allocation_failure(void) {
+  List<String, Storage::Runtime, int, 0, LimitedAllocator> list;
+
+  list.getAllocator().remaining = 1;
+
+  TEST_ASSERT_TRUE(list.tryAdd("a"));
+  TEST_ASSERT_FALSE(list.tryAdd("b"));
+  TEST_ASSERT_EQUAL_INT(1, list.getSize());
+  TEST_ASSERT_EQUAL_STRING("a", list.get(0).c_str());
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Primitive ---------- //
+  RUN_TEST(primitive_tryAdd);
+  RUN_TEST(primitive_tryAdd_size_limit);
+  RUN_TEST(primitive_tryAdd_allocation_failure);
+  RUN_TEST(primitive_add_allocation_failure);
+  RUN_TEST(primitive_insert_allocation_failure);
+  RUN_TEST(primitive_mutable_tryAdd);
+
+  // ---------- String ---------- //
+  RUN_TEST(string_tryAdd_allocation_failure);
+
+  UNITY_END();
+}
+
+void loop() {
+}
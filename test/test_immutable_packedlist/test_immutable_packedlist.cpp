@@ -0,0 +1,219 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <PackedList.hpp>
+#include <SingleLinkedList.hpp>
+
+// ---------- void addAtIndex(int index, T &value) ---------- //
+
+void add_nibbles(void) {
+  PackedList<4> list;
+
+  for (int i = 0; i < 40; ++i) {
+    list.add(i % 16);
+  }
+  list.add(0x1F);
+
+  TEST_ASSERT_EQUAL_INT(41, list.getSize());
+  for (int i = 0; i < 40; ++i) {
+    TEST_ASSERT_EQUAL_INT(i % 16, list.get(i));
+  }
+  TEST_ASSERT_EQUAL_INT(0xF, list.get(40));
+  TEST_ASSERT_FALSE(list.isMutable());
+}
+
+void addAtIndex_bits(void) {
+  PackedList<2> list;
+  int expected[600];
+  int size = 0;
+
+  for (int i = 0; i < 600; ++i) {
+    int index = (i * 7) % (size + 1);
+    list.addAtIndex(index, i % 4);
+    for (int j = size; j > index; --j) {
+      expected[j] = expected[j - 1];
+    }
+    expected[index] = i % 4;
+    size++;
+  }
+
+  TEST_ASSERT_EQUAL_INT(size, list.getSize());
+  for (int i = 0; i < size; ++i) {
+    TEST_ASSERT_EQUAL_INT(expected[i], list.get(i));
+  }
+}
+
+// ---------- void remove(int index) ---------- //
+
+void remove_bytes(void) {
+  PackedList<8> list;
+  int expected[100];
+  int size = 0;
+
+  for (int i = 0; i < 100; ++i) {
+    list.add(i);
+    expected[size++] = i;
+  }
+
+  list.remove(100);
+  list.remove(-1);
+
+  while (size > 0) {
+    int index = (size * 13 + 7) % size;
+    list.remove(index);
+    for (int j = index; j < size - 1; ++j) {
+      expected[j] = expected[j + 1];
+    }
+    size--;
+
+    TEST_ASSERT_EQUAL_INT(size, list.getSize());
+    for (int j = 0; j < size; ++j) {
+      TEST_ASSERT_EQUAL_INT(expected[j], list.get(j));
+    }
+  }
+
+  list.add(1);
+
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+}
+
+void clear_bits(void) {
+  PackedList<1> list;
+
+  for (int i = 0; i < 300; ++i) {
+    list.add(1);
+  }
+  list.clear();
+
+  TEST_ASSERT_TRUE(list.isEmpty());
+
+  list.add(0);
+
+  TEST_ASSERT_EQUAL_INT(0, list.get(0));
+  TEST_ASSERT_EQUAL_INT(1, list.count(0));
+}
+
+// ---------- I count(T value) ---------- //
+
+void count_nibbles(void) {
+  PackedList<4> list;
+
+  TEST_ASSERT_EQUAL_INT(0, list.count(0));
+
+  for (int i = 0; i < 100; ++i) {
+    list.add(i % 5);
+  }
+
+  TEST_ASSERT_EQUAL_INT(20, list.count(0));
+  TEST_ASSERT_EQUAL_INT(20, list.count(4));
+  TEST_ASSERT_EQUAL_INT(0, list.count(5));
+
+  list.remove(0);
+
+  TEST_ASSERT_EQUAL_INT(19, list.count(0));
+}
+
+// ---------- int findFirst(T value) ---------- //
+
+void findFirst_bits(void) {
+  PackedList<1> list;
+
+  for (int i = 0; i < 100; ++i) {
+    list.add(0);
+  }
+
+  TEST_ASSERT_EQUAL_INT(-1, list.findFirst(1));
+
+  list.addAtIndex(70, 1);
+  list.add(1);
+
+  TEST_ASSERT_EQUAL_INT(70, list.findFirst(1));
+  TEST_ASSERT_EQUAL_INT(0, list.findFirst(0));
+
+  list.remove(70);
+
+  TEST_ASSERT_EQUAL_INT(100, list.findFirst(1));
+}
+
+// ---------- size_t getMany(const I *indices, size_t n, T *out) ---------- //
+
+void getMany_nibbles(void) {
+  PackedList<4> list;
+
+  list.add(3);
+  list.add(9);
+  list.add(12);
+
+  int indices[] = {0, 1, 5, 2};
+  uint8_t out[4] = {0, 0, 0, 0};
+
+  TEST_ASSERT_EQUAL_INT(3, list.getMany(indices, 4, out));
+  TEST_ASSERT_EQUAL_INT(3, out[0]);
+  TEST_ASSERT_EQUAL_INT(9, out[1]);
+  TEST_ASSERT_EQUAL_INT(0, out[2]);
+  TEST_ASSERT_EQUAL_INT(12, out[3]);
+}
+
+// ---------- PackedList<1, bool> ---------- //
+
+void bool_add_get(void) {
+  PackedList<1, bool> list;
+
+  for (int i = 0; i < 50; ++i) {
+    list.add(i % 3 == 0);
+  }
+
+  TEST_ASSERT_EQUAL_INT(50, list.getSize());
+  for (int i = 0; i < 50; ++i) {
+    TEST_ASSERT_EQUAL(i % 3 == 0, list.get(i));
+  }
+  TEST_ASSERT_EQUAL_INT(17, list.count(true));
+  TEST_ASSERT_EQUAL_INT(1, list.findFirst(false));
+}
+
+void bool_equals_linked_list(void) {
+  PackedList<1, bool> list;
+  SingleLinkedList<bool> other;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i % 2 == 0);
+    other.add(i % 2 == 0);
+  }
+
+  TEST_ASSERT_TRUE(list == other);
+
+  other.remove(0);
+
+  TEST_ASSERT_FALSE(list == other);
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- void addAtIndex(int index, T &value) ---------- //
+  RUN_TEST(add_nibbles);
+  RUN_TEST(addAtIndex_bits);
+
+  // ---------- void remove(int index) ---------- //
+  RUN_TEST(remove_bytes);
+  RUN_TEST(clear_bits);
+
+  // ---------- I count(T value) ---------- //
+  RUN_TEST(count_nibbles);
+
+  // ---------- int findFirst(T value) ---------- //
+  RUN_TEST(findFirst_bits);
+
+  // ---------- size_t getMany(const I *indices, size_t n, T *out) ---------- //
+  RUN_TEST(getMany_nibbles);
+
+  // ---------- PackedList<1, bool> ---------- //
+  RUN_TEST(bool_add_get);
+  RUN_TEST(bool_equals_linked_list);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -90,6 +90,43 @@ void isEmpty_class(void) {
   TEST_ASSERT_TRUE(list.isEmpty());
 }
 
+// ---------- no default constructor ---------- //
+
+class NoDefaultConstructor {
+  int value;
+
+ public:
+  explicit NoDefaultConstructor(int value) : value(value) {}
+
+  int getValue() const { return value; }
+
+  bool operator!=(const NoDefaultConstructor &other) const { return value != other.value; }
+};
+
+void noDefaultConstructor_class(void) {
+  SingleLinkedList<NoDefaultConstructor> list;
+
+  list.add(NoDefaultConstructor(1));
+  list.add(NoDefaultConstructor(2));
+
+  TEST_ASSERT_EQUAL_INT(2, list.getSize());
+  TEST_ASSERT_EQUAL_INT(1, list.get(0).getValue());
+  TEST_ASSERT_EQUAL_INT(2, list.get(1).getValue());
+
+  list.remove(0);
+
+  TEST_ASSERT_EQUAL_INT(2, list.get(0).getValue());
+}
+
+void noDefaultConstructor_mutable_class(void) {
+  SingleLinkedList<NoDefaultConstructor> list(true);
+
+  NoDefaultConstructor value(1);
+  list.add(value);
+
+  TEST_ASSERT_EQUAL_PTR(&value, list.getMutableValue(0));
+}
+
 void setup() {
   UNITY_BEGIN();
 
@@ -105,6 +142,10 @@ void setup() {
   RUN_TEST(isEmpty_primitive);
   RUN_TEST(isEmpty_class);
 
+  // ---------- no default constructor ---------- //
+  RUN_TEST(noDefaultConstructor_class);
+  RUN_TEST(noDefaultConstructor_mutable_class);
+
   UNITY_END();
 }
 
@@ -0,0 +1,133 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <SingleLinkedList.hpp>
+
+// ---------- sequential get(int index) ---------- //
+
+void get_forward_primitive(void) {
+  SingleLinkedList<int> list;
+
+  for (int i = 0; i < 100; ++i) {
+    list.add(i);
+  }
+
+  for (int i = 0; i < list.getSize(); ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+}
+
+void get_backward_primitive(void) {
+  SingleLinkedList<int> list;
+
+  for (int i = 0; i < 100; ++i) {
+    list.add(i);
+  }
+
+  for (int i = list.getSize() - 1; i >= 0; --i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+}
+
+void get_alternating_class(void) {
+  SingleLinkedList<String> list;
+
+  for (int i = 0; i < 20; ++i) {
+    list.add(String(i));
+  }
+
+  TEST_ASSERT_EQUAL_STRING("10", list.get(10).c_str());
+  TEST_ASSERT_EQUAL_STRING("11", list.get(11).c_str());
+  TEST_ASSERT_EQUAL_STRING("9", list.get(9).c_str());
+  TEST_ASSERT_EQUAL_STRING("15", list.get(15).c_str());
+  TEST_ASSERT_EQUAL_STRING("0", list.get(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("19", list.get(19).c_str());
+}
+
+// ---------- get(int index) after modification ---------- //
+
+void get_after_addAtIndex_primitive(void) {
+  SingleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(5));
+
+  list.addAtIndex(3, 100);
+
+  TEST_ASSERT_EQUAL_INT(4, list.get(5));
+  TEST_ASSERT_EQUAL_INT(5, list.get(6));
+
+  list.addFirst(200);
+
+  TEST_ASSERT_EQUAL_INT(4, list.get(6));
+  TEST_ASSERT_EQUAL_INT(200, list.get(0));
+
+  list.addLast(300);
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(7));
+  TEST_ASSERT_EQUAL_INT(300, list.get(12));
+}
+
+void get_after_remove_primitive(void) {
+  SingleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(5));
+
+  list.remove(5);
+
+  TEST_ASSERT_EQUAL_INT(6, list.get(5));
+
+  list.remove(2);
+
+  TEST_ASSERT_EQUAL_INT(7, list.get(5));
+
+  list.remove(7);
+
+  TEST_ASSERT_EQUAL_INT(7, list.get(5));
+  TEST_ASSERT_EQUAL_INT(8, list.get(6));
+}
+
+void get_after_clear_primitive(void) {
+  SingleLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(5, list.get(5));
+
+  list.clear();
+  for (int i = 10; i < 20; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(15, list.get(5));
+  TEST_ASSERT_EQUAL_INT(16, list.get(6));
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- sequential get(int index) ---------- //
+  RUN_TEST(get_forward_primitive);
+  RUN_TEST(get_backward_primitive);
+  RUN_TEST(get_alternating_class);
+
+  // ---------- get(int index) after modification ---------- //
+  RUN_TEST(get_after_addAtIndex_primitive);
+  RUN_TEST(get_after_remove_primitive);
+  RUN_TEST(get_after_clear_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,165 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <SingleLinkedList.hpp>
+
+// ---------- void enableSkipIndex(int stride) ---------- //
+
+void skipIndex_get_primitive(void) {
+  SingleLinkedList<int> list;
+  list.enableSkipIndex(4);
+
+  for (int i = 0; i < 100; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(50, list.get(50));
+  TEST_ASSERT_EQUAL_INT(3, list.get(3));
+  TEST_ASSERT_EQUAL_INT(97, list.get(97));
+  for (int i = 99; i >= 0; --i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+}
+
+void skipIndex_get_class(void) {
+  SingleLinkedList<String> list;
+  list.enableSkipIndex(3);
+
+  for (int i = 0; i < 30; ++i) {
+    list.add(String(i));
+  }
+
+  TEST_ASSERT_EQUAL_STRING("17", list.get(17).c_str());
+  TEST_ASSERT_EQUAL_STRING("2", list.get(2).c_str());
+  TEST_ASSERT_EQUAL_STRING("29", list.get(29).c_str());
+}
+
+void skipIndex_addAtIndex_remove_primitive(void) {
+  SingleLinkedList<int> list;
+  list.enableSkipIndex(5);
+
+  int expected[128];
+  int size = 0;
+  for (int i = 0; i < 60; ++i) {
+    list.add(i);
+    expected[size++] = i;
+  }
+
+  for (int round = 0; round < 40; ++round) {
+    int index = (round * 37) % size;
+    int check = (round * 53) % size;
+
+    TEST_ASSERT_EQUAL_INT(expected[check], list.get(check));
+
+    if (round % 3 == 0) {
+      list.remove(index);
+      for (int i = index; i < size - 1; ++i) {
+        expected[i] = expected[i + 1];
+      }
+      size--;
+    } else {
+      list.addAtIndex(index, 1000 + round);
+      for (int i = size; i > index; --i) {
+        expected[i] = expected[i - 1];
+      }
+      expected[index] = 1000 + round;
+      size++;
+    }
+
+    TEST_ASSERT_EQUAL_INT(size, list.getSize());
+    for (int i = size - 1; i >= 0; i -= 7) {
+      TEST_ASSERT_EQUAL_INT(expected[i], list.get(i));
+    }
+  }
+
+  list.removeFirst();
+  list.addFirst(-1);
+  list.removeLast();
+
+  TEST_ASSERT_EQUAL_INT(-1, list.get(0));
+  for (int i = 1; i < list.getSize(); ++i) {
+    TEST_ASSERT_EQUAL_INT(expected[i], list.get(i));
+  }
+}
+
+void skipIndex_iterator_modification_primitive(void) {
+  SingleLinkedList<int> list;
+  list.enableSkipIndex(2);
+
+  for (int i = 0; i < 20; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(10, list.get(10));
+
+  SingleLinkedList<int>::Iterator it = list.begin();
+  it = list.erase(it);
+  list.insertAfter(it, 100);
+
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+  TEST_ASSERT_EQUAL_INT(100, list.get(1));
+  TEST_ASSERT_EQUAL_INT(2, list.get(2));
+  TEST_ASSERT_EQUAL_INT(19, list.get(19));
+}
+
+void skipIndex_clear_primitive(void) {
+  SingleLinkedList<int> list;
+  list.enableSkipIndex(2);
+
+  for (int i = 0; i < 20; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(15, list.get(15));
+
+  list.clear();
+  for (int i = 0; i < 10; ++i) {
+    list.add(i * 2);
+  }
+
+  TEST_ASSERT_EQUAL_INT(14, list.get(7));
+  TEST_ASSERT_EQUAL_INT(0, list.get(0));
+}
+
+// ---------- void disableSkipIndex() ---------- //
+
+void disableSkipIndex_primitive(void) {
+  SingleLinkedList<int> list;
+  list.enableSkipIndex(2);
+
+  for (int i = 0; i < 20; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_EQUAL_INT(15, list.get(15));
+
+  list.disableSkipIndex();
+  list.remove(3);
+
+  TEST_ASSERT_EQUAL_INT(16, list.get(15));
+
+  list.enableSkipIndex(3);
+
+  TEST_ASSERT_EQUAL_INT(17, list.get(16));
+  TEST_ASSERT_EQUAL_INT(4, list.get(3));
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- void enableSkipIndex(int stride) ---------- //
+  RUN_TEST(skipIndex_get_primitive);
+  RUN_TEST(skipIndex_get_class);
+  RUN_TEST(skipIndex_addAtIndex_remove_primitive);
+  RUN_TEST(skipIndex_iterator_modification_primitive);
+  RUN_TEST(skipIndex_clear_primitive);
+
+  // ---------- void disableSkipIndex() ---------- //
+  RUN_TEST(disableSkipIndex_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}
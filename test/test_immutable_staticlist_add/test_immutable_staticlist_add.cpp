@@ -0,0 +1,189 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <StaticList.hpp>
+
+// ---------- void add(T &value) ---------- //
+
+void add_primitive(void) {
+  StaticList<int, 100> list;
+
+  for (int i = 0; i < 50; ++i) {
+    list.add(i);
+    TEST_ASSERT_EQUAL_INT(i + 1, list.getSize());
+  }
+
+  for (int i = 0; i < 50; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+}
+
+void add_class(void) {
+  StaticList<String, 100> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(String(i));
+  }
+
+  for (int i = 0; i < 10; ++i) {
+    TEST_ASSERT_EQUAL_STRING(String(i).c_str(), list.get(i).c_str());
+  }
+}
+
+void add_mutable_primitive(void) {
+  StaticList<int, 100> list(true);
+
+  int values[5] = {0, 1, 2, 3, 4};
+  for (int i = 0; i < 5; ++i) {
+    list.add(values[i]);
+  }
+
+  for (int i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_PTR(&values[i], list.getMutableValue(i));
+  }
+}
+
+void add_full_primitive(void) {
+  StaticList<int, 4> list;
+
+  TEST_ASSERT_EQUAL_INT(4, list.getCapacity());
+
+  for (int i = 0; i < 4; ++i) {
+    TEST_ASSERT_FALSE(list.isFull());
+    list.add(i);
+  }
+
+  TEST_ASSERT_TRUE(list.isFull());
+
+  list.add(4);
+  list.addFirst(-1);
+  list.addAtIndex(2, 10);
+
+  TEST_ASSERT_EQUAL_INT(4, list.getSize());
+  for (int i = 0; i < 4; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i));
+  }
+
+  list.removeFirst();
+  list.add(4);
+
+  TEST_ASSERT_TRUE(list.isFull());
+  for (int i = 0; i < 4; ++i) {
+    TEST_ASSERT_EQUAL_INT(i + 1, list.get(i));
+  }
+}
+
+void add_full_index_type_primitive(void) {
+  StaticList<int, 200, Storage::Runtime, uint8_t> list;
+
+  uint8_t capacity = list.getCapacity();
+
+  TEST_ASSERT_EQUAL_INT(200, capacity);
+
+  for (int i = 0; i < 250; ++i) {
+    list.add(i);
+  }
+
+  TEST_ASSERT_TRUE(list.isFull());
+  TEST_ASSERT_EQUAL_INT(200, list.getSize());
+}
+
+// ---------- void addAtIndex(int index, T &value) ---------- //
+
+void addAtIndex_primitive(void) {
+  StaticList<int, 100> list;
+  int expected[100];
+  int size = 0;
+
+  for (int i = 0; i < 60; ++i) {
+    int index = (i * 7) % (size + 1);
+    list.addAtIndex(index, i);
+    for (int j = size; j > index; --j) {
+      expected[j] = expected[j - 1];
+    }
+    expected[index] = i;
+    size++;
+  }
+
+  TEST_ASSERT_EQUAL_INT(size, list.getSize());
+  for (int i = 0; i < size; ++i) {
+    TEST_ASSERT_EQUAL_INT(expected[i], list.get(i));
+  }
+}
+
+void addAtIndex_class(void) {
+  StaticList<String, 100> list;
+
+  list.addAtIndex(0, "3");
+  list.addAtIndex(0, "1");
+  list.addAtIndex(1, "2");
+  list.addAtIndex(3, "4");
+  list.addAtIndex(0, "0");
+  list.addAtIndex(10, "x");
+
+  TEST_ASSERT_EQUAL_INT(5, list.getSize());
+  for (int i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_STRING(String(i).c_str(), list.get(i).c_str());
+  }
+}
+
+// ---------- void addFirst(T &value) ---------- //
+
+void addFirst_primitive(void) {
+  StaticList<int, 100> list;
+
+  for (int i = 0; i < 20; ++i) {
+    list.addFirst(i);
+  }
+
+  for (int i = 0; i < 20; ++i) {
+    TEST_ASSERT_EQUAL_INT(19 - i, list.get(i));
+  }
+}
+
+// ---------- void addAll(AbstractList<T> &list) ---------- //
+
+void addAll_primitive(void) {
+  StaticList<int, 100> list;
+  StaticList<int, 100> other;
+
+  for (int i = 0; i < 10; ++i) {
+    other.add(i);
+  }
+
+  list.add(-1);
+  list.addAll(other);
+
+  TEST_ASSERT_EQUAL_INT(11, list.getSize());
+  TEST_ASSERT_EQUAL_INT(-1, list.get(0));
+  for (int i = 0; i < 10; ++i) {
+    TEST_ASSERT_EQUAL_INT(i, list.get(i + 1));
+  }
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- void add(T &value) ---------- //
+  RUN_TEST(add_primitive);
+  RUN_TEST(add_class);
+  RUN_TEST(add_mutable_primitive);
+  RUN_TEST(add_full_primitive);
+  RUN_TEST(add_full_index_type_primitive);
+
+  // ---------- void addAtIndex(int index, T &value) ---------- //
+  RUN_TEST(addAtIndex_primitive);
+  RUN_TEST(addAtIndex_class);
+
+  // ---------- void addFirst(T &value) ---------- //
+  RUN_TEST(addFirst_primitive);
+
+  // ---------- void addAll(AbstractList<T> &list) ---------- //
+  RUN_TEST(addAll_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,142 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <UnrolledList.hpp>
+
+// ---------- void clear() ---------- //
+
+void clear_primitive(void) {
+  UnrolledList<int, 4> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  list.clear();
+
+  TEST_ASSERT_EQUAL_INT(0, list.getSize());
+
+  list.add(1);
+
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+}
+
+void clear_class(void) {
+  UnrolledList<String, 4> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(String(i));
+  }
+
+  list.clear();
+
+  TEST_ASSERT_EQUAL_INT(0, list.getSize());
+  TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+// ---------- void remove(int index) ---------- //
+
+void remove_primitive(void) {
+  UnrolledList<int, 4> list;
+  int expected[80];
+  int size = 0;
+
+  for (int i = 0; i < 80; ++i) {
+    list.add(i);
+    expected[size++] = i;
+  }
+
+  list.remove(80);
+  list.remove(-1);
+
+  TEST_ASSERT_EQUAL_INT(80, list.getSize());
+
+  while (size > 0) {
+    int index = (size * 13 + 7) % size;
+    list.remove(index);
+    for (int j = index; j < size - 1; ++j) {
+      expected[j] = expected[j + 1];
+    }
+    size--;
+
+    TEST_ASSERT_EQUAL_INT(size, list.getSize());
+    for (int j = 0; j < size; ++j) {
+      TEST_ASSERT_EQUAL_INT(expected[j], list.get(j));
+    }
+  }
+
+  TEST_ASSERT_TRUE(list.isEmpty());
+
+  list.add(1);
+
+  TEST_ASSERT_EQUAL_INT(1, list.get(0));
+}
+
+void remove_mixed_class(void) {
+  UnrolledList<String, 3> list;
+  String expected[40];
+  int size = 0;
+
+  for (int round = 0; round < 120; ++round) {
+    if (size > 0 && round % 3 == 2) {
+      int index = (round * 5) % size;
+      list.remove(index);
+      for (int j = index; j < size - 1; ++j) {
+        expected[j] = expected[j + 1];
+      }
+      size--;
+    } else if (size < 40) {
+      int index = (round * 11) % (size + 1);
+      list.addAtIndex(index, String(round));
+      for (int j = size; j > index; --j) {
+        expected[j] = expected[j - 1];
+      }
+      expected[index] = String(round);
+      size++;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_INT(size, list.getSize());
+  for (int j = 0; j < size; ++j) {
+    TEST_ASSERT_EQUAL_STRING(expected[j].c_str(), list.get(j).c_str());
+  }
+}
+
+// ---------- void removeFirst() / void removeLast() ---------- //
+
+void removeFirst_removeLast_primitive(void) {
+  UnrolledList<int, 2> list;
+
+  for (int i = 0; i < 7; ++i) {
+    list.add(i);
+  }
+
+  list.removeFirst();
+  list.removeLast();
+
+  TEST_ASSERT_EQUAL_INT(5, list.getSize());
+  for (int i = 0; i < 5; ++i) {
+    TEST_ASSERT_EQUAL_INT(i + 1, list.get(i));
+  }
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- void clear() ---------- //
+  RUN_TEST(clear_primitive);
+  RUN_TEST(clear_class);
+
+  // ---------- void remove(int index) ---------- //
+  RUN_TEST(remove_primitive);
+  RUN_TEST(remove_mixed_class);
+
+  // ---------- void removeFirst() / void removeLast() ---------- //
+  RUN_TEST(removeFirst_removeLast_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,100 @@
+#include <Arduino.h>
+
+#include "unity.h"
+
+#include <XorLinkedList.hpp>
+
+// ---------- Iterator begin() / Iterator end() ---------- //
+
+void begin_end_empty(void) {
+  XorLinkedList<int> list;
+
+  TEST_ASSERT_TRUE(list.begin() == list.end());
+  TEST_ASSERT_TRUE(list.rbegin() == list.rend());
+}
+
+void begin_end_primitive(void) {
+  XorLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.add(i);
+  }
+
+  int expected = 0;
+  for (XorLinkedList<int>::Iterator it = list.begin(); it != list.end(); ++it) {
+    TEST_ASSERT_EQUAL_INT(expected++, *it);
+  }
+  TEST_ASSERT_EQUAL_INT(10, expected);
+}
+
+// ---------- ReverseIterator rbegin() / ReverseIterator rend() ---------- //
+
+void rbegin_rend_primitive(void) {
+  XorLinkedList<int> list;
+
+  for (int i = 0; i < 10; ++i) {
+    list.addAtIndex(i / 2, i);
+  }
+  list.removeFirst();
+  list.removeLast();
+
+  int expected[8];
+  for (int i = 0; i < 8; ++i) {
+    expected[i] = list.get(i);
+  }
+
+  int i = 7;
+  for (XorLinkedList<int>::ReverseIterator it = list.rbegin(); it != list.rend(); it++) {
+    TEST_ASSERT_EQUAL_INT(expected[i--], *it);
+  }
+  TEST_ASSERT_EQUAL_INT(-1, i);
+}
+
+void rbegin_rend_class(void) {
+  XorLinkedList<String> list;
+
+  list.add("1");
+  list.add("2");
+  list.add("3");
+
+  String concatenated;
+  for (XorLinkedList<String>::ReverseIterator it = list.rbegin(); it != list.rend(); ++it) {
+    concatenated += *it;
+  }
+  TEST_ASSERT_EQUAL_STRING("321", concatenated.c_str());
+}
+
+// ---------- void forEach(F &&function) ---------- //
+
+void forEach_primitive(void) {
+  XorLinkedList<int> list;
+
+  for (int i = 1; i <= 4; ++i) {
+    list.add(i);
+  }
+
+  int sum = 0;
+  list.forEach([&sum](int &value) { sum += value; });
+
+  TEST_ASSERT_EQUAL_INT(10, sum);
+}
+
+void setup() {
+  UNITY_BEGIN();
+
+  // ---------- Iterator begin() / Iterator end() ---------- //
+  RUN_TEST(begin_end_empty);
+  RUN_TEST(begin_end_primitive);
+
+  // ---------- ReverseIterator rbegin() / ReverseIterator rend() ---------- //
+  RUN_TEST(rbegin_rend_primitive);
+  RUN_TEST(rbegin_rend_class);
+
+  // ---------- void forEach(F &&function) ---------- //
+  RUN_TEST(forEach_primitive);
+
+  UNITY_END();
+}
+
+void loop() {
+}